@@ -4367,6 +4367,322 @@ class StubGenerator: public StubCodeGenerator {
     return start;
   }
 
+  // Round constants of the iota step
+  address keccak_round_consts_addr() {
+    __ align(64);
+    StubCodeMark mark(this, "StubRoutines", "keccak_round_consts");
+    address start = __ pc();
+    __ emit_data64(0x0000000000000001, relocInfo::none);
+    __ emit_data64(0x0000000000008082, relocInfo::none);
+    __ emit_data64(0x800000000000808a, relocInfo::none);
+    __ emit_data64(0x8000000080008000, relocInfo::none);
+    __ emit_data64(0x000000000000808b, relocInfo::none);
+    __ emit_data64(0x0000000080000001, relocInfo::none);
+    __ emit_data64(0x8000000080008081, relocInfo::none);
+    __ emit_data64(0x8000000000008009, relocInfo::none);
+    __ emit_data64(0x000000000000008a, relocInfo::none);
+    __ emit_data64(0x0000000000000088, relocInfo::none);
+    __ emit_data64(0x0000000080008009, relocInfo::none);
+    __ emit_data64(0x000000008000000a, relocInfo::none);
+    __ emit_data64(0x000000008000808b, relocInfo::none);
+    __ emit_data64(0x800000000000008b, relocInfo::none);
+    __ emit_data64(0x8000000000008089, relocInfo::none);
+    __ emit_data64(0x8000000000008003, relocInfo::none);
+    __ emit_data64(0x8000000000008002, relocInfo::none);
+    __ emit_data64(0x8000000000000080, relocInfo::none);
+    __ emit_data64(0x000000000000800a, relocInfo::none);
+    __ emit_data64(0x800000008000000a, relocInfo::none);
+    __ emit_data64(0x8000000080008081, relocInfo::none);
+    __ emit_data64(0x8000000000008080, relocInfo::none);
+    __ emit_data64(0x0000000080000001, relocInfo::none);
+    __ emit_data64(0x8000000080008008, relocInfo::none);
+    return start;
+  }
+
+  // Rotation counts of the rho step for the lanes of each row
+  address keccak_rotation_counts_addr() {
+    __ align(64);
+    StubCodeMark mark(this, "StubRoutines", "keccak_rotation_counts");
+    address start = __ pc();
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000001, relocInfo::none);
+    __ emit_data64(0x000000000000003e, relocInfo::none);
+    __ emit_data64(0x000000000000001c, relocInfo::none);
+    __ emit_data64(0x000000000000001b, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000024, relocInfo::none);
+    __ emit_data64(0x000000000000002c, relocInfo::none);
+    __ emit_data64(0x0000000000000006, relocInfo::none);
+    __ emit_data64(0x0000000000000037, relocInfo::none);
+    __ emit_data64(0x0000000000000014, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000003, relocInfo::none);
+    __ emit_data64(0x000000000000000a, relocInfo::none);
+    __ emit_data64(0x000000000000002b, relocInfo::none);
+    __ emit_data64(0x0000000000000019, relocInfo::none);
+    __ emit_data64(0x0000000000000027, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000029, relocInfo::none);
+    __ emit_data64(0x000000000000002d, relocInfo::none);
+    __ emit_data64(0x000000000000000f, relocInfo::none);
+    __ emit_data64(0x0000000000000015, relocInfo::none);
+    __ emit_data64(0x0000000000000008, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000012, relocInfo::none);
+    __ emit_data64(0x0000000000000002, relocInfo::none);
+    __ emit_data64(0x000000000000003d, relocInfo::none);
+    __ emit_data64(0x0000000000000038, relocInfo::none);
+    __ emit_data64(0x000000000000000e, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    return start;
+  }
+
+  // Lane indexes for vpermq: for every row of the pi step the source lanes, followed by
+  // the rotations of a row by one lane to the left, one lane to the right and two lanes
+  // to the left
+  address keccak_permute_indexes_addr() {
+    __ align(64);
+    StubCodeMark mark(this, "StubRoutines", "keccak_permute_indexes");
+    address start = __ pc();
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000001, relocInfo::none);
+    __ emit_data64(0x0000000000000002, relocInfo::none);
+    __ emit_data64(0x0000000000000003, relocInfo::none);
+    __ emit_data64(0x0000000000000004, relocInfo::none);
+    __ emit_data64(0x0000000000000005, relocInfo::none);
+    __ emit_data64(0x0000000000000006, relocInfo::none);
+    __ emit_data64(0x0000000000000007, relocInfo::none);
+    __ emit_data64(0x0000000000000003, relocInfo::none);
+    __ emit_data64(0x0000000000000004, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000001, relocInfo::none);
+    __ emit_data64(0x0000000000000002, relocInfo::none);
+    __ emit_data64(0x0000000000000005, relocInfo::none);
+    __ emit_data64(0x0000000000000006, relocInfo::none);
+    __ emit_data64(0x0000000000000007, relocInfo::none);
+    __ emit_data64(0x0000000000000001, relocInfo::none);
+    __ emit_data64(0x0000000000000002, relocInfo::none);
+    __ emit_data64(0x0000000000000003, relocInfo::none);
+    __ emit_data64(0x0000000000000004, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000005, relocInfo::none);
+    __ emit_data64(0x0000000000000006, relocInfo::none);
+    __ emit_data64(0x0000000000000007, relocInfo::none);
+    __ emit_data64(0x0000000000000004, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000001, relocInfo::none);
+    __ emit_data64(0x0000000000000002, relocInfo::none);
+    __ emit_data64(0x0000000000000003, relocInfo::none);
+    __ emit_data64(0x0000000000000005, relocInfo::none);
+    __ emit_data64(0x0000000000000006, relocInfo::none);
+    __ emit_data64(0x0000000000000007, relocInfo::none);
+    __ emit_data64(0x0000000000000002, relocInfo::none);
+    __ emit_data64(0x0000000000000003, relocInfo::none);
+    __ emit_data64(0x0000000000000004, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000001, relocInfo::none);
+    __ emit_data64(0x0000000000000005, relocInfo::none);
+    __ emit_data64(0x0000000000000006, relocInfo::none);
+    __ emit_data64(0x0000000000000007, relocInfo::none);
+    __ emit_data64(0x0000000000000001, relocInfo::none);
+    __ emit_data64(0x0000000000000002, relocInfo::none);
+    __ emit_data64(0x0000000000000003, relocInfo::none);
+    __ emit_data64(0x0000000000000004, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000005, relocInfo::none);
+    __ emit_data64(0x0000000000000006, relocInfo::none);
+    __ emit_data64(0x0000000000000007, relocInfo::none);
+    __ emit_data64(0x0000000000000004, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000001, relocInfo::none);
+    __ emit_data64(0x0000000000000002, relocInfo::none);
+    __ emit_data64(0x0000000000000003, relocInfo::none);
+    __ emit_data64(0x0000000000000005, relocInfo::none);
+    __ emit_data64(0x0000000000000006, relocInfo::none);
+    __ emit_data64(0x0000000000000007, relocInfo::none);
+    __ emit_data64(0x0000000000000002, relocInfo::none);
+    __ emit_data64(0x0000000000000003, relocInfo::none);
+    __ emit_data64(0x0000000000000004, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000001, relocInfo::none);
+    __ emit_data64(0x0000000000000005, relocInfo::none);
+    __ emit_data64(0x0000000000000006, relocInfo::none);
+    __ emit_data64(0x0000000000000007, relocInfo::none);
+    return start;
+  }
+
+  // Keccak-f[1600] for SHA3.
+  //
+  // Arguments:
+  //
+  // Inputs:
+  //   c_rarg0   - byte[]  source+offset
+  //   c_rarg1   - byte[]  SHA.state
+  //   c_rarg2   - int     digest_length
+  //   c_rarg3   - int     offset
+  //   c_rarg4   - int     limit
+  //
+  // The state is kept in five registers, one row of five 64-bit lanes each.
+  // Rows are loaded and stored with a five-lane mask.
+  address generate_sha3_implCompress(bool multi_block, const char *name) {
+    assert(VM_Version::supports_evex(), "");
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", name);
+    address start = __ pc();
+
+    const Register buf           = c_rarg0;
+    const Register state         = c_rarg1;
+    const Register digest_length = c_rarg2;
+    const Register ofs           = c_rarg3;
+#ifndef _WIN64
+    const Register limit         = c_rarg4;
+#else
+    const Address  limit_mem(rbp, 6 * wordSize);  // limit is on stack on Win64
+#endif
+    const Register block_size    = r11;
+    const Register round_consts  = r10;
+    const Register tmp           = rax;
+
+    const XMMRegister row[5]     = { xmm0, xmm1, xmm2, xmm3, xmm4 };
+    const XMMRegister pi_row[5]  = { xmm5, xmm6, xmm7, xmm8, xmm9 };
+    const XMMRegister pi_idx[5]  = { xmm10, xmm11, xmm12, xmm13, xmm14 };
+    const XMMRegister rotation[5] = { xmm15, xmm16, xmm17, xmm18, xmm19 };
+    const XMMRegister next_lane  = xmm20;
+    const XMMRegister prev_lane  = xmm21;
+    const XMMRegister next2_lane = xmm22;
+    const XMMRegister parity     = xmm23;
+    const XMMRegister parity_prev = xmm24;
+    const XMMRegister parity_next = xmm25;
+    const XMMRegister tmp1       = xmm26;
+    const XMMRegister tmp2       = xmm27;
+    const XMMRegister round_const = xmm28;
+    // k1-k4 select a single lane for merging the pi step rows, k5 lane 0 for
+    // the iota step and k6 the five lanes of a row.
+    const KRegister lane_mask[5] = { k5, k1, k2, k3, k4 };
+    const KRegister row_mask     = k6;
+
+    Label L_block, L_absorb, L_rounds;
+
+    __ enter();
+
+    // The masks fit in 16 bits, so kmovw is enough and the stub only
+    // requires AVX-512F.
+    for (int i = 0; i < 5; i++) {
+      __ movl(tmp, 1 << i);
+      __ kmovwl(lane_mask[i], tmp);
+    }
+    __ movl(tmp, 0x1f);
+    __ kmovwl(row_mask, tmp);
+
+    __ lea(round_consts, ExternalAddress(StubRoutines::x86::keccak_rotation_counts_addr()));
+    for (int i = 0; i < 5; i++) {
+      __ evmovdquq(rotation[i], Address(round_consts, i * 64), Assembler::AVX_512bit);
+    }
+    __ lea(round_consts, ExternalAddress(StubRoutines::x86::keccak_permute_indexes_addr()));
+    for (int i = 0; i < 5; i++) {
+      __ evmovdquq(pi_idx[i], Address(round_consts, i * 64), Assembler::AVX_512bit);
+    }
+    __ evmovdquq(next_lane, Address(round_consts, 5 * 64), Assembler::AVX_512bit);
+    __ evmovdquq(prev_lane, Address(round_consts, 6 * 64), Assembler::AVX_512bit);
+    __ evmovdquq(next2_lane, Address(round_consts, 7 * 64), Assembler::AVX_512bit);
+
+    // block_size = 200 - 2 * digest_length
+    __ movl(block_size, 200);
+    __ subl(block_size, digest_length);
+    __ subl(block_size, digest_length);
+
+    __ BIND(L_block);
+    // Absorb the next block into the state, 8 bytes at a time.
+    __ xorl(tmp, tmp);
+    __ BIND(L_absorb);
+    __ movq(digest_length, Address(buf, tmp, Address::times_1));
+    __ xorq(Address(state, tmp, Address::times_1), digest_length);
+    __ addl(tmp, 8);
+    __ cmpl(tmp, block_size);
+    __ jcc(Assembler::less, L_absorb);
+
+    for (int i = 0; i < 5; i++) {
+      __ evmovdquq(row[i], row_mask, Address(state, i * 40), false, Assembler::AVX_512bit);
+    }
+
+    // 24 keccak rounds
+    __ lea(round_consts, ExternalAddress(StubRoutines::x86::keccak_round_consts_addr()));
+    __ movl(tmp, 24);
+    __ BIND(L_rounds);
+
+    // Theta: xor every lane with the parities of the columns to its left and
+    // (rotated by one) to its right.
+    __ evmovdquq(parity, row[0], Assembler::AVX_512bit);
+    __ vpternlogq(parity, 0x96, row[1], row[2], Assembler::AVX_512bit);
+    __ vpternlogq(parity, 0x96, row[3], row[4], Assembler::AVX_512bit);
+    __ vpermq(parity_prev, prev_lane, parity, Assembler::AVX_512bit);
+    __ vpermq(parity_next, next_lane, parity, Assembler::AVX_512bit);
+    __ evprolq(parity_next, parity_next, 1, Assembler::AVX_512bit);
+    for (int i = 0; i < 5; i++) {
+      __ vpternlogq(row[i], 0x96, parity_prev, parity_next, Assembler::AVX_512bit);
+    }
+
+    // Rho: rotate every lane by its own amount.
+    for (int i = 0; i < 5; i++) {
+      __ evprolvq(row[i], row[i], rotation[i], Assembler::AVX_512bit);
+    }
+
+    // Pi: lane x of the new row y is lane (3 * y + x) % 5 of the old row x.
+    for (int y = 0; y < 5; y++) {
+      __ vpermq(pi_row[y], pi_idx[y], row[0], Assembler::AVX_512bit);
+      for (int x = 1; x < 5; x++) {
+        __ evpermq(pi_row[y], lane_mask[x], pi_idx[y], row[x], true, Assembler::AVX_512bit);
+      }
+    }
+
+    // Chi: a[x] = b[x] ^ (~b[x + 1] & b[x + 2]) within every row.
+    for (int i = 0; i < 5; i++) {
+      __ vpermq(tmp1, next_lane, pi_row[i], Assembler::AVX_512bit);
+      __ vpermq(tmp2, next2_lane, pi_row[i], Assembler::AVX_512bit);
+      __ evmovdquq(row[i], pi_row[i], Assembler::AVX_512bit);
+      __ vpternlogq(row[i], 0xD2, tmp1, tmp2, Assembler::AVX_512bit);
+    }
+
+    // Iota: xor the round constant into lane 0.
+    __ evmovdquq(round_const, lane_mask[0], Address(round_consts, 0), false, Assembler::AVX_512bit);
+    __ evpxorq(row[0], row[0], round_const, Assembler::AVX_512bit);
+
+    __ addptr(round_consts, 8);
+    __ decrementl(tmp);
+    __ jcc(Assembler::notZero, L_rounds);
+
+    for (int i = 0; i < 5; i++) {
+      __ evmovdquq(Address(state, i * 40), row_mask, row[i], true, Assembler::AVX_512bit);
+    }
+
+    if (multi_block) {
+      __ addptr(buf, block_size);
+      __ addl(ofs, block_size);
+#ifndef _WIN64
+      __ cmpl(ofs, limit);
+#else
+      __ cmpl(ofs, limit_mem);
+#endif
+      __ jcc(Assembler::lessEqual, L_block);
+      __ movl(rax, ofs); // return ofs
+    }
+
+    __ vzeroupper();
+    __ leave();
+    __ ret(0);
+    return start;
+  }
+
   // This mask is used for incrementing counter value(linc0, linc4, etc.)
   address counter_mask_addr() {
     __ align(64);
@@ -5438,6 +5754,70 @@ address generate_avx_ghash_processBlocks() {
     return start;
   }
 
+  // Maps the 128 ASCII characters to their 6-bit values, 0x80 for characters not in the alphabet
+  address base64_decoding_table_addr() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "decoding_table_base64");
+    address start = __ pc();
+    __ emit_data64(0x8080808080808080, relocInfo::none);
+    __ emit_data64(0x8080808080808080, relocInfo::none);
+    __ emit_data64(0x8080808080808080, relocInfo::none);
+    __ emit_data64(0x8080808080808080, relocInfo::none);
+    __ emit_data64(0x8080808080808080, relocInfo::none);
+    __ emit_data64(0x3f8080803e808080, relocInfo::none);
+    __ emit_data64(0x3b3a393837363534, relocInfo::none);
+    __ emit_data64(0x8080808080803d3c, relocInfo::none);
+    __ emit_data64(0x0605040302010080, relocInfo::none);
+    __ emit_data64(0x0e0d0c0b0a090807, relocInfo::none);
+    __ emit_data64(0x161514131211100f, relocInfo::none);
+    __ emit_data64(0x8080808080191817, relocInfo::none);
+    __ emit_data64(0x201f1e1d1c1b1a80, relocInfo::none);
+    __ emit_data64(0x2827262524232221, relocInfo::none);
+    __ emit_data64(0x302f2e2d2c2b2a29, relocInfo::none);
+    __ emit_data64(0x8080808080333231, relocInfo::none);
+    return start;
+  }
+
+  // Same as base64_decoding_table_addr() for the URL and Filename safe alphabet
+  address base64url_decoding_table_addr() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "decoding_table_base64url");
+    address start = __ pc();
+    __ emit_data64(0x8080808080808080, relocInfo::none);
+    __ emit_data64(0x8080808080808080, relocInfo::none);
+    __ emit_data64(0x8080808080808080, relocInfo::none);
+    __ emit_data64(0x8080808080808080, relocInfo::none);
+    __ emit_data64(0x8080808080808080, relocInfo::none);
+    __ emit_data64(0x80803e8080808080, relocInfo::none);
+    __ emit_data64(0x3b3a393837363534, relocInfo::none);
+    __ emit_data64(0x8080808080803d3c, relocInfo::none);
+    __ emit_data64(0x0605040302010080, relocInfo::none);
+    __ emit_data64(0x0e0d0c0b0a090807, relocInfo::none);
+    __ emit_data64(0x161514131211100f, relocInfo::none);
+    __ emit_data64(0x3f80808080191817, relocInfo::none);
+    __ emit_data64(0x201f1e1d1c1b1a80, relocInfo::none);
+    __ emit_data64(0x2827262524232221, relocInfo::none);
+    __ emit_data64(0x302f2e2d2c2b2a29, relocInfo::none);
+    __ emit_data64(0x8080808080333231, relocInfo::none);
+    return start;
+  }
+
+  // Gathers the three decoded bytes of every dword, most significant byte first
+  address base64_decoding_pack_mask_addr() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "decoding_pack_mask_base64");
+    address start = __ pc();
+    __ emit_data64(0x090a040506000102, relocInfo::none);
+    __ emit_data64(0x161011120c0d0e08, relocInfo::none);
+    __ emit_data64(0x1c1d1e18191a1415, relocInfo::none);
+    __ emit_data64(0x292a242526202122, relocInfo::none);
+    __ emit_data64(0x363031322c2d2e28, relocInfo::none);
+    __ emit_data64(0x3c3d3e38393a3435, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    __ emit_data64(0x0000000000000000, relocInfo::none);
+    return start;
+  }
+
 // Code for generating Base64 encoding.
 // Intrinsic function prototype in Base64.java:
 // private void encodeBlock(byte[] src, int sp, int sl, byte[] dst, int dp, boolean isURL) {
@@ -5682,6 +6062,113 @@ address generate_avx_ghash_processBlocks() {
     return start;
   }
 
+// Code for generating Base64 decoding.
+// Intrinsic function prototype in Base64.java:
+// private int decodeBlock(byte[] src, int sp, int sl, byte[] dst, int dp, boolean isURL) {
+//
+// Decodes 64 characters into 48 bytes per iteration. Stops at the first block
+// containing a character that is not in the alphabet (including padding) or if
+// fewer than 64 characters are left, and returns the number of bytes written.
+// The caller decodes the remainder.
+  address generate_base64_decodeBlock() {
+    __ align(CodeEntryAlignment);
+    StubCodeMark mark(this, "StubRoutines", "implDecode");
+    address start = __ pc();
+    __ enter();
+
+    // arguments
+    const Register source = c_rarg0; // Source Array
+    const Register start_offset = c_rarg1; // start offset
+    const Register end_offset = c_rarg2; // end offset
+    const Register dest = c_rarg3; // destination array
+
+#ifndef _WIN64
+    const Register dp = c_rarg4;  // Position for writing to dest array
+    const Register isURL = c_rarg5;// Base64 or URL character set
+#else
+    // Save callee-saved register before using it
+    __ push(r12);
+    const Address  dp_mem(rbp, 6 * wordSize);  // length is on stack on Win64
+    const Address isURL_mem(rbp, 7 * wordSize);
+    const Register isURL = r10;      // pick the volatile windows register
+    const Register dp = r12;
+    __ movl(dp, dp_mem);
+    __ movl(isURL, isURL_mem);
+#endif
+
+    const Register length = r11;
+    const Register written = rax;
+    Label L_process64, L_loadURL, L_loadTables, L_exit;
+
+    // calculate length from offsets
+    __ movl(length, end_offset);
+    __ subl(length, start_offset);
+    __ movslq(start_offset, start_offset);
+    __ movslq(dp, dp);
+    __ addq(source, start_offset);
+    __ addq(dest, dp);
+    __ xorl(written, written);
+    __ cmpl(length, 64);
+    __ jcc(Assembler::less, L_exit);
+
+    // check if base64 (isURL=0) or base64 url (isURL=1) decoding table needs to be loaded
+    __ cmpl(isURL, 0);
+    __ jcc(Assembler::notEqual, L_loadURL);
+    __ lea(r10, ExternalAddress(StubRoutines::x86::base64_decoding_table_addr()));
+    __ jmp(L_loadTables);
+    __ BIND(L_loadURL);
+    __ lea(r10, ExternalAddress(StubRoutines::x86::base64url_decoding_table_addr()));
+    __ BIND(L_loadTables);
+    // The decoding table for characters 0-63 and 64-127
+    __ evmovdquq(xmm1, Address(r10, 0), Assembler::AVX_512bit);
+    __ evmovdquq(xmm2, Address(r10, 64), Assembler::AVX_512bit);
+    __ evmovdquq(xmm5, ExternalAddress(StubRoutines::x86::base64_decoding_pack_mask_addr()), Assembler::AVX_512bit, r10);
+    // Multipliers merging four 6-bit values into one 24-bit value in two steps
+    __ movl(r10, 0x01400140);
+    __ evpbroadcastd(xmm3, r10, Assembler::AVX_512bit);
+    __ movl(r10, 0x00011000);
+    __ evpbroadcastd(xmm4, r10, Assembler::AVX_512bit);
+    // Only the lower 48 bytes of each 64-byte vector hold decoded data
+    __ mov64(r10, 0x0000ffffffffffff);
+    __ kmovql(k2, r10);
+
+    __ BIND(L_process64);
+    __ cmpl(length, 64);
+    __ jcc(Assembler::less, L_exit);
+    __ evmovdquq(xmm0, Address(source, 0), Assembler::AVX_512bit);
+    // Translate the characters to their 6-bit values, using the lower 7 bits of
+    // every character as index into the decoding table
+    __ evmovdquq(xmm6, xmm0, Assembler::AVX_512bit);
+    __ evpermi2b(xmm6, xmm1, xmm2, Assembler::AVX_512bit);
+    // Characters >= 0x80 and characters not in the alphabet have the high bit
+    // set in either the input or the translated value
+    __ vporq(xmm7, xmm6, xmm0, Assembler::AVX_512bit);
+    __ evpmovb2m(k3, xmm7, Assembler::AVX_512bit);
+    __ kortestql(k3, k3);
+    __ jcc(Assembler::notZero, L_exit);
+    // Merge a, b, c, d into (a << 6 | b), (c << 6 | d) words and then into
+    // (a << 18 | b << 12 | c << 6 | d) dwords
+    __ vpmaddubsw(xmm6, xmm6, xmm3, Assembler::AVX_512bit);
+    __ vpmaddwd(xmm6, xmm6, xmm4, Assembler::AVX_512bit);
+    // Pack the three bytes of every dword in big endian order and store them
+    __ vpermb(xmm6, xmm5, xmm6, Assembler::AVX_512bit);
+    __ evmovdqub(Address(dest, 0), k2, xmm6, true, Assembler::AVX_512bit);
+    __ addq(source, 64);
+    __ addq(dest, 48);
+    __ addl(written, 48);
+    __ subl(length, 64);
+    __ jmp(L_process64);
+
+    __ BIND(L_exit);
+    __ vzeroupper();
+#ifdef _WIN64
+    __ pop(r12);
+#endif
+    __ leave();
+    __ ret(0);
+    return start;
+  }
+
   /**
    *  Arguments:
    *
@@ -6945,6 +7432,13 @@ address generate_avx_ghash_processBlocks() {
       StubRoutines::_sha512_implCompress = generate_sha512_implCompress(false, "sha512_implCompress");
       StubRoutines::_sha512_implCompressMB = generate_sha512_implCompress(true, "sha512_implCompressMB");
     }
+    if (UseSHA3Intrinsics) {
+      StubRoutines::x86::_keccak_round_consts = keccak_round_consts_addr();
+      StubRoutines::x86::_keccak_rotation_counts = keccak_rotation_counts_addr();
+      StubRoutines::x86::_keccak_permute_indexes = keccak_permute_indexes_addr();
+      StubRoutines::_sha3_implCompress = generate_sha3_implCompress(false, "sha3_implCompress");
+      StubRoutines::_sha3_implCompressMB = generate_sha3_implCompress(true, "sha3_implCompressMB");
+    }
 
     // Generate GHASH intrinsics code
     if (UseGHASHIntrinsics) {
@@ -6968,6 +7462,12 @@ address generate_avx_ghash_processBlocks() {
       StubRoutines::x86::_left_shift_mask = base64_left_shift_mask_addr();
       StubRoutines::x86::_right_shift_mask = base64_right_shift_mask_addr();
       StubRoutines::_base64_encodeBlock = generate_base64_encodeBlock();
+      if (VM_Version::supports_avx512_vbmi()) {
+        StubRoutines::x86::_base64_decoding_table = base64_decoding_table_addr();
+        StubRoutines::x86::_base64url_decoding_table = base64url_decoding_table_addr();
+        StubRoutines::x86::_base64_decoding_pack_mask = base64_decoding_pack_mask_addr();
+        StubRoutines::_base64_decodeBlock = generate_base64_decodeBlock();
+      }
     }
 
     BarrierSetNMethod* bs_nm = BarrierSet::barrier_set()->barrier_set_nmethod();
@@ -72,6 +72,12 @@ address StubRoutines::x86::_right_shift_mask = NULL;
 address StubRoutines::x86::_left_shift_mask = NULL;
 address StubRoutines::x86::_and_mask = NULL;
 address StubRoutines::x86::_url_charset = NULL;
+address StubRoutines::x86::_base64_decoding_table = NULL;
+address StubRoutines::x86::_base64url_decoding_table = NULL;
+address StubRoutines::x86::_base64_decoding_pack_mask = NULL;
+address StubRoutines::x86::_keccak_round_consts = NULL;
+address StubRoutines::x86::_keccak_rotation_counts = NULL;
+address StubRoutines::x86::_keccak_permute_indexes = NULL;
 address StubRoutines::x86::_counter_mask_addr = NULL;
 #endif
 address StubRoutines::x86::_pshuffle_byte_flip_mask_addr = NULL;
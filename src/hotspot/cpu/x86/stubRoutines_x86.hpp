@@ -33,7 +33,9 @@ static bool returns_to_call_stub(address return_pc) { return return_pc == _call_
 
 enum platform_dependent_constants {
   code_size1 = 20000 LP64_ONLY(+10000),         // simply increase if too small (assembler will crash if too small)
-  code_size2 = 35300 LP64_ONLY(+25000)          // simply increase if too small (assembler will crash if too small)
+  // The AVX-512 stubs for Base64 decoding and SHA3 need 1500 bytes each,
+  // tables included.
+  code_size2 = 35300 LP64_ONLY(+25000 +1500 +1500) // simply increase if too small (assembler will crash if too small)
 };
 
 class x86 {
@@ -191,6 +193,13 @@ class x86 {
   static address _left_shift_mask;
   static address _and_mask;
   static address _url_charset;
+  static address _base64_decoding_table;
+  static address _base64url_decoding_table;
+  static address _base64_decoding_pack_mask;
+  // Constants for SHA3
+  static address _keccak_round_consts;
+  static address _keccak_rotation_counts;
+  static address _keccak_permute_indexes;
 #endif
   // byte flip mask for sha256
   static address _pshuffle_byte_flip_mask_addr;
@@ -335,6 +344,12 @@ class x86 {
   static address base64_right_shift_mask_addr() { return _right_shift_mask; }
   static address base64_left_shift_mask_addr() { return _left_shift_mask; }
   static address base64_and_mask_addr() { return _and_mask; }
+  static address base64_decoding_table_addr() { return _base64_decoding_table; }
+  static address base64url_decoding_table_addr() { return _base64url_decoding_table; }
+  static address base64_decoding_pack_mask_addr() { return _base64_decoding_pack_mask; }
+  static address keccak_round_consts_addr() { return _keccak_round_consts; }
+  static address keccak_rotation_counts_addr() { return _keccak_rotation_counts; }
+  static address keccak_permute_indexes_addr() { return _keccak_permute_indexes; }
   static address counter_mask_addr() { return _counter_mask_addr; }
 #endif
   static address pshuffle_byte_flip_mask_addr() { return _pshuffle_byte_flip_mask_addr; }
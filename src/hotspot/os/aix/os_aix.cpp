@@ -1320,6 +1320,10 @@ void os::print_memory_info(outputStream* st) {
   vmembk_print_on(st);
 }
 
+bool os::trim_native_heap() {
+  return false;
+}
+
 // Get a string for the cpuinfo that is a summary of the cpu type
 void os::get_summary_cpu_info(char* buf, size_t buflen) {
   // read _system_configuration.version
@@ -1925,6 +1929,10 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
 }
 
+bool os::pd_pretouch_memory(void* start, void* end) {
+  return false;
+}
+
 void os::numa_make_global(char *addr, size_t bytes) {
 }
 
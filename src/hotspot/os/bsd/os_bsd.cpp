@@ -1423,6 +1423,10 @@ void os::print_memory_info(outputStream* st) {
   st->cr();
 }
 
+bool os::trim_native_heap() {
+  return false;
+}
+
 static char saved_jvm_path[MAXPATHLEN] = {0};
 
 // Find the full path to the current module, libjvm
@@ -1626,6 +1630,10 @@ void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   ::madvise(addr, bytes, MADV_DONTNEED);
 }
 
+bool os::pd_pretouch_memory(void* start, void* end) {
+  return false;
+}
+
 void os::numa_make_global(char *addr, size_t bytes) {
 }
 
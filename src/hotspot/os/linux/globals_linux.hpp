@@ -82,7 +82,11 @@
           "Use CPU_ALLOC code path in os::active_processor_count ")     \
                                                                         \
   product(bool, DumpPerfMapAtExit, false, DIAGNOSTIC,                   \
-          "Write map file for Linux perf tool at exit")
+          "Write map file for Linux perf tool at exit")                 \
+                                                                        \
+  product(bool, WritePerfMap, false, DIAGNOSTIC,                        \
+          "Append to the map file for Linux perf tool whenever code is "\
+          "generated")
 
 // end of RUNTIME_OS_FLAGS
 
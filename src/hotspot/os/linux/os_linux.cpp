@@ -2352,6 +2352,15 @@ void os::print_memory_info(outputStream* st) {
   st->cr();
 }
 
+bool os::trim_native_heap() {
+#ifdef __GLIBC__
+  ::malloc_trim(0);
+  return true;
+#else
+  return false;
+#endif
+}
+
 // Print the first "model name" line and the first "flags" line
 // that we find and nothing more. We assume "model name" comes
 // before "flags" so if we find a second "model name", then the
@@ -2765,6 +2774,11 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   #define MADV_HUGEPAGE 14
 #endif
 
+// Define MADV_POPULATE_WRITE here so we can build HotSpot on old systems.
+#ifndef MADV_POPULATE_WRITE
+  #define MADV_POPULATE_WRITE 23
+#endif
+
 int os::Linux::commit_memory_impl(char* addr, size_t size,
                                   size_t alignment_hint, bool exec) {
   int err = os::Linux::commit_memory_impl(addr, size, exec);
@@ -2799,6 +2813,29 @@ void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   }
 }
 
+// Set once the kernel turned out not to support MADV_POPULATE_WRITE (added in
+// Linux 5.14). Racing updates all store the same value.
+static volatile bool _populate_write_unsupported = false;
+
+bool os::pd_pretouch_memory(void* start, void* end) {
+  if (_populate_write_unsupported) {
+    return false;
+  }
+  // Populating writable memory in the kernel saves a page fault per page, and
+  // faults in transparent huge pages wherever they are enabled for the range.
+  // The pages containing start and end - 1 are part of the range.
+  char* first = align_down((char*)start, os::vm_page_size());
+  char* last = align_up((char*)end, os::vm_page_size());
+  if (::madvise(first, pointer_delta(last, first, 1), MADV_POPULATE_WRITE) == 0) {
+    return true;
+  }
+  if (errno == EINVAL) {
+    log_debug(os)("MADV_POPULATE_WRITE not supported, pre-touching pages individually");
+    _populate_write_unsupported = true;
+  }
+  return false;
+}
+
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) {
   // This method works by doing an mmap over an existing mmaping and effectively discarding
   // the existing pages. However it won't work for SHM-based large pages that cannot be
@@ -4786,7 +4823,36 @@ void os::set_native_thread_name(const char *name) {
 }
 
 bool os::bind_to_processor(uint processor_id) {
-  // Not yet implemented.
+  // Use the affinity mask of the primordial thread rather than the one of
+  // the current thread, which may already be bound. It reflects cpusets and
+  // any restriction imposed by the launcher, e.g. taskset or numactl.
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  if (sched_getaffinity(getpid(), sizeof(allowed), &allowed) != 0) {
+    // Also fails for masks larger than cpu_set_t; do not bind then.
+    return false;
+  }
+
+  int const num_allowed = CPU_COUNT(&allowed);
+  if (num_allowed == 0) {
+    return false;
+  }
+
+  int index = (int)(processor_id % (uint)num_allowed);
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &allowed) && index-- == 0) {
+      cpu_set_t target;
+      CPU_ZERO(&target);
+      CPU_SET(cpu, &target);
+      // pid 0 means the current thread.
+      if (sched_setaffinity(0, sizeof(target), &target) != 0) {
+        return false;
+      }
+      log_debug(os, thread)("Thread " INTX_FORMAT " bound to processor %d",
+                            os::current_thread_id(), cpu);
+      return true;
+    }
+  }
   return false;
 }
 
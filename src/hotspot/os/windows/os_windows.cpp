@@ -1968,6 +1968,10 @@ void os::print_memory_info(outputStream* st) {
   st->cr();
 }
 
+bool os::trim_native_heap() {
+  return false;
+}
+
 bool os::signal_sent_by_kill(const void* siginfo) {
   // TODO: Is this possible?
   return false;
@@ -3693,6 +3697,7 @@ bool os::unguard_memory(char* addr, size_t bytes) {
 
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) { }
 void os::pd_free_memory(char *addr, size_t bytes, size_t alignment_hint) { }
+bool os::pd_pretouch_memory(void* start, void* end) { return false; }
 void os::numa_make_global(char *addr, size_t bytes)    { }
 void os::numa_make_local(char *addr, size_t bytes, int lgrp_hint)    { }
 bool os::numa_topology_changed()                       { return false; }
@@ -1584,28 +1584,37 @@ void LinearScan::sort_intervals_before_allocation() {
   IntervalArray* sorted_list = new IntervalArray(sorted_len, sorted_len, NULL);
 
   // special sorting algorithm: the original interval-list is almost sorted,
-  // only some intervals are swapped. So this is much faster than a complete QuickSort
+  // only some intervals are swapped. So this is much faster than a complete QuickSort.
+  // Insertion gets quadratic if many intervals are out of order though (huge methods),
+  // so give up after a linear number of moves and sort the remaining part completely.
+  int moves = 0;
+  bool needs_sort = false;
   for (unsorted_idx = 0; unsorted_idx < unsorted_len; unsorted_idx++) {
     Interval* cur_interval = unsorted_list->at(unsorted_idx);
 
     if (cur_interval != NULL) {
       int cur_from = cur_interval->from();
 
-      if (sorted_from_max <= cur_from) {
+      if (needs_sort || sorted_from_max <= cur_from) {
         sorted_list->at_put(sorted_idx++, cur_interval);
-        sorted_from_max = cur_interval->from();
+        sorted_from_max = MAX2(sorted_from_max, cur_from);
       } else {
         // the asumption that the intervals are already sorted failed,
         // so this interval must be sorted in manually
         int j;
         for (j = sorted_idx - 1; j >= 0 && cur_from < sorted_list->at(j)->from(); j--) {
           sorted_list->at_put(j + 1, sorted_list->at(j));
+          moves++;
         }
         sorted_list->at_put(j + 1, cur_interval);
         sorted_idx++;
+        needs_sort = moves > sorted_len;
       }
     }
   }
+  if (needs_sort) {
+    sorted_list->sort(interval_cmp);
+  }
   _sorted_intervals = sorted_list;
   assert(is_sorted(_sorted_intervals), "intervals unsorted");
 }
@@ -46,6 +46,7 @@
 #include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
+#include "runtime/timer.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/utf8.hpp"
@@ -594,9 +595,23 @@ class CompileReplay : public StackObj {
       nm->make_not_entrant();
     }
     replay_state = this;
+    elapsedTimer compile_timer;
+    compile_timer.start();
     CompileBroker::compile_method(methodHandle(THREAD, method), entry_bci, comp_level,
                                   methodHandle(), 0, CompileTask::Reason_Replay, THREAD);
+    compile_timer.stop();
     replay_state = NULL;
+    // Report how long the compile took and how large the result is, so that
+    // replay files can be used to compare compiler changes offline. Together
+    // with RepeatCompilation this gives repeated measurements of the same
+    // compile with the recorded profile.
+    nm = (entry_bci != InvocationEntryBci) ? method->lookup_osr_nmethod_for(entry_bci, comp_level, true) : method->code();
+    {
+      ResourceMark rm(THREAD);
+      tty->print_cr("ciReplay: compiled %s at level %d, bci %d in %.3f ms, code size %d",
+                    method->name_and_sig_as_C_string(), comp_level, entry_bci,
+                    compile_timer.seconds() * 1000.0, nm != NULL ? nm->insts_size() : 0);
+    }
     reset();
   }
 
@@ -560,9 +560,17 @@ void ClassLoaderDataGraph::clean_module_and_package_info() {
 }
 
 void ClassLoaderDataGraph::purge(bool at_safepoint) {
+  purge(take_unloading_list(), at_safepoint);
+}
+
+ClassLoaderData* ClassLoaderDataGraph::take_unloading_list() {
   ClassLoaderData* list = _unloading;
   _unloading = NULL;
-  ClassLoaderData* next = list;
+  return list;
+}
+
+void ClassLoaderDataGraph::purge(ClassLoaderData* unloading, bool at_safepoint) {
+  ClassLoaderData* next = unloading;
   bool classes_unloaded = false;
   while (next != NULL) {
     ClassLoaderData* purge_me = next;
@@ -662,6 +670,44 @@ Klass* ClassLoaderDataGraphKlassIteratorAtomic::next_klass() {
   return NULL;
 }
 
+ClassLoaderDataGraphParRootsIterator::ClassLoaderDataGraphParRootsIterator()
+    : _next(ClassLoaderDataGraph::_head) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint!");
+}
+
+ClassLoaderData* ClassLoaderDataGraphParRootsIterator::claim_chunk(ClassLoaderData** end) {
+  ClassLoaderData* head = Atomic::load(&_next);
+
+  while (head != NULL) {
+    ClassLoaderData* next = head->next();
+    for (uint i = 1; i < ChunkSize && next != NULL; i++) {
+      next = next->next();
+    }
+
+    ClassLoaderData* old_head = Atomic::cmpxchg(&_next, head, next);
+
+    if (old_head == head) {
+      *end = next;
+      return head; // Won the CAS.
+    }
+
+    head = old_head;
+  }
+  return NULL;
+}
+
+void ClassLoaderDataGraphParRootsIterator::roots_cld_do(CLDClosure* strong, CLDClosure* weak) {
+  ClassLoaderData* end;
+  for (ClassLoaderData* first = claim_chunk(&end); first != NULL; first = claim_chunk(&end)) {
+    for (ClassLoaderData* cld = first; cld != end; cld = cld->next()) {
+      CLDClosure* closure = cld->keep_alive() ? strong : weak;
+      if (closure != NULL) {
+        closure->do_cld(cld);
+      }
+    }
+  }
+}
+
 void ClassLoaderDataGraph::verify() {
   ClassLoaderDataGraphIterator iter;
   while (ClassLoaderData* cld = iter.get_next()) {
@@ -36,6 +36,7 @@ class ClassLoaderDataGraph : public AllStatic {
   friend class ClassLoaderData;
   friend class ClassLoaderDataGraphMetaspaceIterator;
   friend class ClassLoaderDataGraphKlassIteratorAtomic;
+  friend class ClassLoaderDataGraphParRootsIterator;
   friend class ClassLoaderDataGraphKlassIteratorStatic;
   friend class ClassLoaderDataGraphIterator;
   friend class VMStructs;
@@ -63,6 +64,11 @@ class ClassLoaderDataGraph : public AllStatic {
   static ClassLoaderData* add(Handle class_loader, bool has_class_mirror_holder);
   static void clean_module_and_package_info();
   static void purge(bool at_safepoint);
+  // Purging in two steps for callers that must not block safepoints while
+  // deleting the ClassLoaderData: the list of unloaded ClassLoaderData is
+  // detached while synchronized with safepoints, and then purged without.
+  static ClassLoaderData* take_unloading_list();
+  static void purge(ClassLoaderData* unloading, bool at_safepoint);
   static void clear_claimed_marks();
   static void clear_claimed_marks(int claim);
   // Iteration through CLDG inside a safepoint; GC support
@@ -162,4 +168,23 @@ class ClassLoaderDataGraphKlassIteratorAtomic : public StackObj {
   static Klass* next_klass_in_cldg(Klass* klass);
 };
 
+// Distributes the CLDs of the CLDG to parallel worker threads for root
+// scanning. Workers claim chunks of consecutive CLDs to keep the number of
+// atomic operations on the shared cursor low.
+class ClassLoaderDataGraphParRootsIterator : public StackObj {
+  static const uint ChunkSize = 16;
+
+  ClassLoaderData* volatile _next;
+
+  // Claims the next chunk of CLDs, returns its first CLD and sets end to the
+  // CLD after its last one. Returns NULL if there is nothing left to claim.
+  ClassLoaderData* claim_chunk(ClassLoaderData** end);
+ public:
+  ClassLoaderDataGraphParRootsIterator();
+
+  // Parallel version of ClassLoaderDataGraph::roots_cld_do(); every CLD is
+  // processed by exactly one of the calling workers.
+  void roots_cld_do(CLDClosure* strong, CLDClosure* weak);
+};
+
 #endif // SHARE_CLASSFILE_CLASSLOADERDATAGRAPH_HPP
@@ -197,6 +197,11 @@ void RuntimeBlob::trace_new_stub(RuntimeBlob* stub, const char* name1, const cha
       tty->cr();
     }
     Forte::register_stub(stub_id, stub->code_begin(), stub->code_end());
+#ifdef LINUX
+    if (WritePerfMap) {
+      CodeCache::write_perf_map_entry(stub_id, stub->code_begin(), stub->code_end());
+    }
+#endif
 
     if (JvmtiExport::should_post_dynamic_code_generated()) {
       const char* stub_name = name2;
@@ -1557,19 +1557,44 @@ void CodeCache::log_state(outputStream* st) {
 }
 
 #ifdef LINUX
-void CodeCache::write_perf_map() {
-  MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+// State of the incremental perf map, protected by CodeCache_lock.
+static fileStream* _perf_map = NULL;
+static bool _perf_map_failed = false;
+static jlong _perf_map_last_flush = 0;
 
+static void perf_map_file_name(char* buf, size_t len) {
   // Perf expects to find the map file at /tmp/perf-<pid>.map.
-  char fname[32];
-  jio_snprintf(fname, sizeof(fname), "/tmp/perf-%d.map", os::current_process_id());
+  jio_snprintf(buf, len, "/tmp/perf-%d.map", os::current_process_id());
+}
 
-  fileStream fs(fname, "w");
-  if (!fs.is_open()) {
-    log_warning(codecache)("Failed to create %s for perf map", fname);
-    return;
+// Opens the incremental perf map on first use. Returns false if that failed.
+static bool open_perf_map() {
+  assert_locked_or_safepoint(CodeCache_lock);
+  if (_perf_map == NULL) {
+    if (_perf_map_failed) {
+      return false;
+    }
+    char fname[32];
+    perf_map_file_name(fname, sizeof(fname));
+    fileStream* fs = new (ResourceObj::C_HEAP, mtCode) fileStream(fname, "w");
+    if (!fs->is_open()) {
+      log_warning(codecache)("Failed to create %s for perf map", fname);
+      delete fs;
+      _perf_map_failed = true;
+      return false;
+    }
+    _perf_map = fs;
+    _perf_map_last_flush = os::javaTimeNanos();
   }
+  return true;
+}
+
+static void print_perf_map_entry(outputStream* st, const char* name, address begin, address end) {
+  st->print_cr(INTPTR_FORMAT " " INTPTR_FORMAT " %s",
+               (intptr_t)begin, (intptr_t)(end - begin), name);
+}
 
+static void print_perf_map_blobs(outputStream* st) {
   AllCodeBlobsIterator iter(AllCodeBlobsIterator::only_alive_and_not_unloading);
   while (iter.next()) {
     CodeBlob *cb = iter.method();
@@ -1577,9 +1602,77 @@ void CodeCache::write_perf_map() {
     const char* method_name =
       cb->is_compiled() ? cb->as_compiled_method()->method()->external_name()
                         : cb->name();
-    fs.print_cr(INTPTR_FORMAT " " INTPTR_FORMAT " %s",
-                (intptr_t)cb->code_begin(), (intptr_t)cb->code_size(),
-                method_name);
+    print_perf_map_entry(st, method_name, cb->code_begin(), cb->code_end());
+  }
+}
+
+// Writes all code blobs to /tmp/perf-<pid>.map. With WritePerfMap that file is
+// already being written incrementally, so the blobs are appended to it instead
+// of truncating it underneath the incremental stream.
+void CodeCache::write_perf_map() {
+  if (WritePerfMap) {
+    {
+      MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+      if (!open_perf_map()) {
+        return;
+      }
+      print_perf_map_blobs(_perf_map);
+    }
+    _perf_map->flush();
+    return;
+  }
+
+  MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+
+  char fname[32];
+  perf_map_file_name(fname, sizeof(fname));
+  fileStream fs(fname, "w");
+  if (!fs.is_open()) {
+    log_warning(codecache)("Failed to create %s for perf map", fname);
+    return;
+  }
+  print_perf_map_blobs(&fs);
+}
+
+// Appends an entry for the given code range to /tmp/perf-<pid>.map. Entries
+// are buffered and the file is flushed at most once per second; perf only reads
+// the map when resolving samples, so this does not lose information as long as
+// the file is flushed at exit (see flush_perf_map()). The map format has no way
+// to express removal of code, so profilers see the latest entry for an address.
+// The flush is done after releasing CodeCache_lock; the stream is never deleted
+// once opened, and stdio serializes the flush with concurrent writes.
+void CodeCache::write_perf_map_entry(const char* name, address begin, address end) {
+  assert(WritePerfMap, "must be");
+  bool locked_by_caller = CodeCache_lock->owned_by_self();
+  bool needs_flush = false;
+  {
+    MutexLocker mu(locked_by_caller ? NULL : CodeCache_lock,
+                   Mutex::_no_safepoint_check_flag);
+    if (!open_perf_map()) {
+      return;
+    }
+    print_perf_map_entry(_perf_map, name, begin, end);
+
+    // Callers holding CodeCache_lock leave the flush to a later entry.
+    jlong now = os::javaTimeNanos();
+    if (!locked_by_caller && now - _perf_map_last_flush >= NANOSECS_PER_SEC) {
+      _perf_map_last_flush = now;
+      needs_flush = true;
+    }
+  }
+  if (needs_flush) {
+    _perf_map->flush();
+  }
+}
+
+void CodeCache::flush_perf_map() {
+  fileStream* perf_map;
+  {
+    MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    perf_map = _perf_map;
+  }
+  if (perf_map != NULL) {
+    perf_map->flush();
   }
 }
 #endif // LINUX
@@ -192,6 +192,9 @@ class CodeCache : AllStatic {
   static void print_summary(outputStream* st, bool detailed = true); // Prints a summary of the code cache usage
   static void log_state(outputStream* st);
   LINUX_ONLY(static void write_perf_map();)
+  // Incremental perf map support for WritePerfMap.
+  LINUX_ONLY(static void write_perf_map_entry(const char* name, address begin, address end);)
+  LINUX_ONLY(static void flush_perf_map();)
   static const char* get_code_heap_name(int code_blob_type)  { return (heap_available(code_blob_type) ? get_code_heap(code_blob_type)->name() : "Unused"); }
   static void report_codemem_full(int code_blob_type, bool print);
 
@@ -887,6 +887,12 @@ void nmethod::log_identity(xmlStream* log) const {
 
 
 void nmethod::log_new_nmethod() const {
+#ifdef LINUX
+  if (WritePerfMap) {
+    ResourceMark rm;
+    CodeCache::write_perf_map_entry(method()->external_name(), code_begin(), code_end());
+  }
+#endif
   if (LogCompilation && xtty != NULL) {
     ttyLocker ttyl;
     xtty->begin_elem("nmethod");
@@ -234,6 +234,9 @@ public:
     if (CompilerOracle::has_option_value(method, CompileCommand::CompileThresholdScaling, threshold_scaling)) {
       scale *= threshold_scaling;
     }
+    if (cur_level == CompLevel_full_profile) {
+      scale *= CompilationPolicy::decompile_backoff_scale(method);
+    }
     switch(cur_level) {
     case CompLevel_none:
     case CompLevel_limited_profile:
@@ -272,6 +275,9 @@ public:
     if (CompilerOracle::has_option_value(method, CompileCommand::CompileThresholdScaling, threshold_scaling)) {
       scale *= threshold_scaling;
     }
+    if (cur_level == CompLevel_full_profile) {
+      scale *= CompilationPolicy::decompile_backoff_scale(method);
+    }
     switch(cur_level) {
     case CompLevel_none:
     case CompLevel_limited_profile:
@@ -304,6 +310,17 @@ public:
   }
 };
 
+double CompilationPolicy::decompile_backoff_scale(const methodHandle& method) {
+  if (Tier4DecompileBackoffLimit > 0) {
+    MethodData* mdo = method->method_data();
+    if (mdo != NULL) {
+      uint decompiles = MIN2(mdo->decompile_count(), (uint)Tier4DecompileBackoffLimit);
+      return (double)(1 << decompiles);
+    }
+  }
+  return 1;
+}
+
 double CompilationPolicy::threshold_scale(CompLevel level, int feedback_k) {
   int comp_count = compiler_count(level);
   if (comp_count > 0) {
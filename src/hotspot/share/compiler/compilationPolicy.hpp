@@ -201,6 +201,9 @@ class CompilationPolicy : AllStatic {
   inline static void update_rate(jlong t, Method* m);
   // Compute threshold scaling coefficient
   inline static double threshold_scale(CompLevel level, int feedback_k);
+  // Compute the scaling of tier 4 thresholds for methods whose C2 code has been
+  // repeatedly made not entrant
+  static double decompile_backoff_scale(const methodHandle& method);
   // If a method is old enough and is still in the interpreter we would want to
   // start profiling without waiting for the compiled method to arrive. This function
   // determines whether we should do that.
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "jvm.h"
+#include "classfile/classLoaderDataGraph.hpp"
 #include "classfile/javaClasses.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/vmClasses.hpp"
@@ -371,6 +372,8 @@ void CompileQueue::add(CompileTask* task) {
     _last = task;
   }
   ++_size;
+  ++_total_added;
+  _peak_size = MAX2(_peak_size, _size);
 
   // Mark the method as being in the compile queue.
   task->method()->set_queued_for_compilation();
@@ -474,6 +477,7 @@ CompileTask* CompileQueue::get() {
     save_hot_method = methodHandle(thread, task->hot_method());
 
     remove(task);
+    ++_total_removed;
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
   return task;
@@ -525,6 +529,7 @@ void CompileQueue::remove(CompileTask* task) {
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
   assert(MethodCompileQueue_lock->owned_by_self(), "must own lock");
   remove(task);
+  ++_total_stale;
 
   // Enqueue the task for reclamation (should be done outside MCQ lock)
   task->set_next(_first_stale);
@@ -565,6 +570,45 @@ void CompileBroker::print_compile_queues(outputStream* st) {
   }
 }
 
+// Methods collected by print_hot_methods(); only used at a safepoint.
+static GrowableArray<Method*>* _hot_methods = NULL;
+
+static jlong method_hotness(Method* m) {
+  return (jlong)m->invocation_count() + m->backedge_count();
+}
+
+static void collect_hot_method(Method* m) {
+  if ((m->method_counters() != NULL || m->method_data() != NULL) && method_hotness(m) > 0) {
+    _hot_methods->append(m);
+  }
+}
+
+static int compare_method_hotness(Method** a, Method** b) {
+  jlong ha = method_hotness(*a);
+  jlong hb = method_hotness(*b);
+  return ha > hb ? -1 : (ha < hb ? 1 : 0);
+}
+
+void CompileBroker::print_hot_methods(outputStream* st, int count) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  ResourceMark rm;
+  GrowableArray<Method*> methods(1024);
+  _hot_methods = &methods;
+  ClassLoaderDataGraph::methods_do(collect_hot_method);
+  _hot_methods = NULL;
+  methods.sort(compare_method_hotness);
+
+  st->print_cr("%12s %12s %5s %s", "invocations", "backedges", "level", "method");
+  for (int i = 0; i < MIN2(count, methods.length()); i++) {
+    Method* m = methods.at(i);
+    CompiledMethod* code = m->code();
+    st->print_cr("%12d %12d %5d %s",
+                 m->invocation_count(), m->backedge_count(),
+                 code != NULL ? code->comp_level() : CompLevel_none,
+                 m->name_and_sig_as_C_string());
+  }
+}
+
 void CompileQueue::print(outputStream* st) {
   assert_locked_or_safepoint(MethodCompileQueue_lock);
   st->print_cr("%s:", name());
@@ -1070,9 +1114,27 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
+  // With an ergonomic compiler count, also respect the number of processors
+  // currently available, which follows the CPU quota when running in a
+  // container. Threads above these limits are not added and are removed
+  // again by can_remove() once idle.
+  int c1_limit = _c1_count;
+  int c2_limit = _c2_count;
+  if (CICompilerCountPerCPU) {
+    int cpus = os::active_processor_count();
+    if (_c1_compile_queue == NULL) {
+      c2_limit = MIN2(c2_limit, cpus);
+    } else if (_c2_compile_queue == NULL) {
+      c1_limit = MIN2(c1_limit, cpus);
+    } else {
+      c1_limit = MIN2(c1_limit, MAX2(cpus / 3, 1));
+      c2_limit = MIN2(c2_limit, MAX2(cpus - c1_limit, 1));
+    }
+  }
+
   if (_c2_compile_queue != NULL) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
-    int new_c2_count = MIN4(_c2_count,
+    int new_c2_count = MIN4(c2_limit,
         _c2_compile_queue->size() / 2,
         (int)(available_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
@@ -1126,7 +1188,7 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c1_compile_queue != NULL) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
-    int new_c1_count = MIN4(_c1_count,
+    int new_c1_count = MIN4(c1_limit,
         _c1_compile_queue->size() / 4,
         (int)(available_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
@@ -89,6 +89,10 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   CompileTask* _first_stale;
 
   int _size;
+  int _peak_size;
+  uint64_t _total_added;
+  uint64_t _total_removed;
+  uint64_t _total_stale;
 
   void purge_stale_tasks();
  public:
@@ -97,6 +101,10 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _first = NULL;
     _last = NULL;
     _size = 0;
+    _peak_size = 0;
+    _total_added = 0;
+    _total_removed = 0;
+    _total_stale = 0;
     _first_stale = NULL;
   }
 
@@ -113,6 +121,13 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   bool         is_empty() const                  { return _first == NULL; }
   int          size()     const                  { return _size;          }
 
+  // Statistics, updated and read under MethodCompileQueue_lock. Tasks removed
+  // as stale are counted in total_stale() only.
+  int          peak_size() const                 { return _peak_size;     }
+  uint64_t     total_added() const               { return _total_added;   }
+  uint64_t     total_removed() const             { return _total_removed; }
+  uint64_t     total_stale() const               { return _total_stale;   }
+
 
   // Redefine Classes support
   void mark_on_stack();
@@ -292,6 +307,9 @@ public:
   static bool compilation_is_complete(const methodHandle& method, int osr_bci, int comp_level);
   static bool compilation_is_in_queue(const methodHandle& method);
   static void print_compile_queues(outputStream* st);
+  // Print the count methods with the highest invocation plus backedge counts.
+  // Must be called at a safepoint.
+  static void print_hot_methods(outputStream* st, int count);
   static int queue_size(int comp_level) {
     CompileQueue *q = compile_queue(comp_level);
     return q != NULL ? q->size() : 0;
@@ -402,6 +420,9 @@ public:
 
   static CompileLog* get_log(CompilerThread* ct);
 
+  static CompileQueue* c1_compile_queue() {         return _c1_compile_queue; }
+  static CompileQueue* c2_compile_queue() {         return _c2_compile_queue; }
+
   static int get_total_compile_count() {            return _total_compile_count; }
   static int get_total_bailout_count() {            return _total_bailout_count; }
   static int get_total_invalidated_count() {        return _total_invalidated_count; }
@@ -73,7 +73,13 @@ NOT_PRODUCT(cflags(PrintIdeal,          bool, PrintIdeal, PrintIdeal)) \
 NOT_PRODUCT(cflags(IGVPrintLevel,       intx, PrintIdealGraphLevel, IGVPrintLevel)) \
     cflags(VectorizeDebug,          uintx, 0, VectorizeDebug) \
     cflags(IncrementalInlineForceCleanup, bool, IncrementalInlineForceCleanup, IncrementalInlineForceCleanup) \
-    cflags(MaxNodeLimit,            intx, MaxNodeLimit, MaxNodeLimit)
+    cflags(MaxNodeLimit,            intx, MaxNodeLimit, MaxNodeLimit) \
+    cflags(PolymorphicInlineLimit,  intx, PolymorphicInlineLimit, PolymorphicInlineLimit) \
+    cflags(MaxInlineLevel,          intx, MaxInlineLevel, MaxInlineLevel) \
+    cflags(MaxInlineSize,           intx, MaxInlineSize, MaxInlineSize) \
+    cflags(FreqInlineSize,          intx, FreqInlineSize, FreqInlineSize) \
+    cflags(LoopUnrollLimit,         intx, LoopUnrollLimit, LoopUnrollLimit) \
+    cflags(UseSuperWord,            bool, UseSuperWord, UseSuperWord)
 #else
   #define compilerdirectives_c2_flags(cflags)
 #endif
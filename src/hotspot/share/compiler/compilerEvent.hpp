@@ -72,7 +72,10 @@ class CompilerEvent : AllStatic {
     // If `sync` is true, then access to the registration table is synchronized.
     static int get_phase_id(const char* phase_name, bool may_exist, bool use_strdup, bool sync) NOT_JFR_RETURN_(-1);
 
-    static void post(EventCompilerPhase& event, const Ticks& start_time, int phase, int compile_id, int level) NOT_JFR_RETURN();
+    // `cpu_time` is the thread CPU time spent in the phase and `arena_size` the memory held by the
+    // compiler's arenas at the end of the phase, both 0 if not measured.
+    static void post(EventCompilerPhase& event, const Ticks& start_time, int phase, int compile_id, int level,
+                     jlong cpu_time = 0, size_t arena_size = 0) NOT_JFR_RETURN();
     static void post(EventCompilerPhase& event, jlong start_time, int phase, int compile_id, int level) {
       JFR_ONLY(post(event, Ticks(start_time), phase, compile_id, level);)
     }
@@ -86,6 +86,12 @@ class methodHandle;
   option(CloneMapDebug, "CloneMapDebug", Bool) \
   option(IncrementalInlineForceCleanup, "IncrementalInlineForceCleanup", Bool) \
   option(MaxNodeLimit, "MaxNodeLimit", Intx)  \
+  option(PolymorphicInlineLimit, "PolymorphicInlineLimit", Intx) \
+  option(MaxInlineLevel, "MaxInlineLevel", Intx) \
+  option(MaxInlineSize, "MaxInlineSize", Intx) \
+  option(FreqInlineSize, "FreqInlineSize", Intx) \
+  option(LoopUnrollLimit, "LoopUnrollLimit", Intx) \
+  option(UseSuperWord, "UseSuperWord", Bool) \
 NOT_PRODUCT(option(TestOptionInt,    "TestOptionInt",    Intx)) \
 NOT_PRODUCT(option(TestOptionUint,   "TestOptionUint",   Uintx)) \
 NOT_PRODUCT(option(TestOptionBool,   "TestOptionBool",   Bool)) \
@@ -233,6 +233,12 @@
           "reaches this amount per compiler thread")                        \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, Tier4DecompileBackoffLimit, 0, EXPERIMENTAL,                \
+          "Double the thresholds of tier 4 compilations for every time the "\
+          "method's C2 code was made not entrant, up to this many times. "  \
+          "0 disables the back-off")                                        \
+          range(0, 16)                                                      \
+                                                                            \
   product(intx, TieredCompileTaskTimeout, 50,                               \
           "Kill compile task if method was not used within "                \
           "given timeout in milliseconds")                                  \
@@ -23,19 +23,48 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "code/codeCache.hpp"
+#include "compiler/oopMap.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
 #include "gc/epsilon/epsilonInitLogger.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
+#include "gc/shared/gcId.hpp"
+#include "gc/shared/gcLocker.hpp"
+#include "gc/shared/gcTraceTime.inline.hpp"
+#include "gc/shared/gcVMOperations.hpp"
+#include "gc/shared/isGCActiveMark.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
+#include "gc/shared/oopStorageSet.inline.hpp"
+#include "gc/shared/preservedMarks.inline.hpp"
+#include "gc/shared/strongRootsScope.hpp"
+#include "gc/shared/weakProcessor.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/compressedOops.inline.hpp"
+#include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/biasedLocking.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/init.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "runtime/vmThread.hpp"
+#include "services/memTracker.hpp"
+#include "services/memoryService.hpp"
+#include "utilities/copy.hpp"
+#include "utilities/stack.inline.hpp"
+#if INCLUDE_JVMTI
+#include "prims/jvmtiTagMap.hpp"
+#endif
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -64,6 +93,22 @@ jint EpsilonHeap::initialize() {
   _last_counter_update = 0;
   _last_heap_print = 0;
 
+  // Reserve the marking bitmap. It is only committed when a collection runs,
+  // so it takes no memory unless the heap is actually exhausted.
+  if (EpsilonSlidingGC) {
+    size_t bitmap_page_size = os::vm_page_size();
+    size_t bitmap_size = align_up(MarkBitMap::compute_size(heap_rs.size()), bitmap_page_size);
+    ReservedSpace bitmap(bitmap_size, bitmap_page_size);
+    if (!bitmap.is_reserved()) {
+      log_warning(gc)("Could not reserve native memory for marking bitmap");
+      return JNI_ENOMEM;
+    }
+    MemTracker::record_virtual_memory_type(bitmap.base(), mtGC);
+    _bitmap_region = MemRegion((HeapWord*) bitmap.base(), bitmap.size() / HeapWordSize);
+    MemRegion heap_region = MemRegion((HeapWord*) heap_rs.base(), heap_rs.size() / HeapWordSize);
+    _bitmap.initialize(heap_region, _bitmap_region);
+  }
+
   // Install barrier set
   BarrierSet::set_barrier_set(new EpsilonBarrierSet());
 
@@ -236,7 +281,7 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
   }
 
   // All prepared, let's do it!
-  HeapWord* res = allocate_work(size);
+  HeapWord* res = allocate_or_collect_work(size);
 
   if (res != NULL) {
     // Allocation successful
@@ -260,7 +305,43 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
 
 HeapWord* EpsilonHeap::mem_allocate(size_t size, bool *gc_overhead_limit_was_exceeded) {
   *gc_overhead_limit_was_exceeded = false;
-  return allocate_work(size);
+  return allocate_or_collect_work(size);
+}
+
+HeapWord* EpsilonHeap::allocate_or_collect_work(size_t size) {
+  HeapWord* res = allocate_work(size);
+  if (res == NULL && EpsilonSlidingGC && is_init_completed() && Thread::current()->is_Java_thread()) {
+    JavaThread* thread = JavaThread::current();
+    bool collected = false;
+    uint gclocker_stalled_count = 0;
+    while (res == NULL) {
+      if (GCLocker::is_active_and_needs_gc()) {
+        // The collection has been skipped because of a JNI critical region.
+        // Stall until the last thread leaving its critical region has done
+        // the collection, unless this thread is in a critical region itself.
+        if (thread->in_critical()) {
+          if (CheckJNICalls) {
+            fatal("Possible deadlock due to allocating while"
+                  " in jni critical section");
+          }
+          return NULL;
+        }
+        if (gclocker_stalled_count > GCLockerRetryAllocationCount) {
+          return NULL;
+        }
+        GCLocker::stall_until_clear();
+        gclocker_stalled_count += 1;
+      } else if (!collected) {
+        vmentry_collect(GCCause::_allocation_failure);
+        collected = true;
+      } else {
+        // The heap is full of live objects.
+        return NULL;
+      }
+      res = allocate_work(size);
+    }
+  }
+  return res;
 }
 
 void EpsilonHeap::collect(GCCause::Cause cause) {
@@ -277,7 +358,15 @@ void EpsilonHeap::collect(GCCause::Cause cause) {
       print_metaspace_info();
       break;
     default:
-      log_info(gc)("GC request for \"%s\" is ignored", GCCause::to_string(cause));
+      if (EpsilonSlidingGC) {
+        if (SafepointSynchronize::is_at_safepoint()) {
+          entry_collect(cause);
+        } else {
+          vmentry_collect(cause);
+        }
+      } else {
+        log_info(gc)("GC request for \"%s\" is ignored", GCCause::to_string(cause));
+      }
   }
   _monitoring_support->update_counters();
 }
@@ -290,6 +379,294 @@ void EpsilonHeap::object_iterate(ObjectClosure *cl) {
   _space->object_iterate(cl);
 }
 
+bool EpsilonHeap::supports_object_pinning() const {
+  // Moving objects requires JNI critical regions to go through the GCLocker.
+  return !EpsilonSlidingGC;
+}
+
+// ------------------ EpsilonSlidingGC ---------------
+//
+// A simple LISP2-style mark-compact: mark all reachable objects in a bitmap,
+// compute their new addresses by sliding them towards the bottom of the
+// space and store these in the mark words, update all references, and
+// finally move the objects. Everything is done by the VM thread in a
+// single pause. Nothing is ever unloaded or cleared, weak roots and
+// java.lang.ref.Reference referents are treated as strong.
+
+class VM_EpsilonCollect: public VM_GC_Operation {
+public:
+  VM_EpsilonCollect(uint gc_count_before, uint full_gc_count_before, GCCause::Cause cause) :
+    VM_GC_Operation(gc_count_before, cause, full_gc_count_before, true /* full */) {}
+
+  virtual VMOp_Type type() const { return VMOp_EpsilonCollect; }
+  virtual void doit() {
+    EpsilonHeap* heap = EpsilonHeap::heap();
+    GCCauseSetter gccs(heap, _gc_cause);
+    heap->entry_collect(_gc_cause);
+  }
+};
+
+void EpsilonHeap::vmentry_collect(GCCause::Cause cause) {
+  uint gc_count_before;
+  uint full_gc_count_before;
+  {
+    MutexLocker ml(Heap_lock);
+    gc_count_before = total_collections();
+    full_gc_count_before = total_full_collections();
+  }
+  VM_EpsilonCollect vmop(gc_count_before, full_gc_count_before, cause);
+  VMThread::execute(&vmop);
+}
+
+typedef Stack<oop, mtGC> EpsilonMarkStack;
+
+// Marks the objects referenced from the visited locations and pushes the
+// newly marked ones on the mark stack.
+class EpsilonScanOopClosure : public BasicOopIterateClosure {
+private:
+  EpsilonMarkStack* const _stack;
+  MarkBitMap* const _bitmap;
+
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      oop obj = CompressedOops::decode_not_null(o);
+      // Single-threaded, non-atomic check and mark is enough.
+      if (!_bitmap->is_marked(obj)) {
+        _bitmap->mark(obj);
+        _stack->push(obj);
+      }
+    }
+  }
+
+public:
+  EpsilonScanOopClosure(EpsilonMarkStack* stack, MarkBitMap* bitmap) :
+    _stack(stack), _bitmap(bitmap) {}
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+// Computes the new location of every live object and stores it as the
+// forwardee in its mark word, preserving the mark words that need it.
+class EpsilonCalcNewLocationObjectClosure : public ObjectClosure {
+private:
+  HeapWord* _compact_point;
+  PreservedMarks* const _preserved_marks;
+
+public:
+  EpsilonCalcNewLocationObjectClosure(HeapWord* start, PreservedMarks* pm) :
+    _compact_point(start), _preserved_marks(pm) {}
+
+  void do_object(oop obj) {
+    // Objects that do not move, e.g. in the dense prefix, are not forwarded
+    // so that the later phases can skip them.
+    if (obj != cast_to_oop(_compact_point)) {
+      _preserved_marks->push_if_necessary(obj, obj->mark());
+      obj->forward_to(cast_to_oop(_compact_point));
+    }
+    _compact_point += obj->size();
+  }
+
+  HeapWord* compact_point() const { return _compact_point; }
+};
+
+// Updates the visited locations to the new locations of the objects.
+class EpsilonAdjustPointersOopClosure : public BasicOopIterateClosure {
+private:
+  template <class T>
+  void do_oop_work(T* p) {
+    T o = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(o)) {
+      oop obj = CompressedOops::decode_not_null(o);
+      if (obj->is_forwarded()) {
+        RawAccess<IS_NOT_NULL>::oop_store(p, obj->forwardee());
+      }
+    }
+  }
+
+public:
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+class EpsilonAdjustPointersObjectClosure : public ObjectClosure {
+private:
+  EpsilonAdjustPointersOopClosure _cl;
+
+public:
+  void do_object(oop obj) {
+    obj->oop_iterate(&_cl);
+  }
+};
+
+// Copies the forwarded objects to their new locations. Objects only slide
+// towards lower addresses and are visited in address order, so an object
+// is never overwritten before it has been moved.
+class EpsilonMoveObjectsObjectClosure : public ObjectClosure {
+private:
+  size_t _moved;
+
+public:
+  EpsilonMoveObjectsObjectClosure() : _moved(0) {}
+
+  void do_object(oop obj) {
+    if (obj->is_forwarded()) {
+      oop fwd = obj->forwardee();
+      size_t size = obj->size();
+      Copy::aligned_conjoint_words(cast_from_oop<HeapWord*>(obj), cast_from_oop<HeapWord*>(fwd), size);
+      fwd->init_mark();
+      _moved++;
+    }
+  }
+
+  size_t moved() const { return _moved; }
+};
+
+void EpsilonHeap::process_roots(OopClosure* cl) {
+  StrongRootsScope scope(0);
+
+  CLDToOopClosure clds(cl, ClassLoaderData::_claim_none);
+  MarkingCodeBlobClosure blobs(cl, CodeBlobToOopClosure::FixRelocations);
+
+  // Each root location must be visited exactly once, as adjusting it twice
+  // would use the forwarding information of whatever object is currently
+  // at the new location. MarkingCodeBlobClosure makes sure of that for the
+  // nmethods found both in the code cache and on the stacks.
+  CodeCache::blobs_do(&blobs);
+  ClassLoaderDataGraph::cld_do(&clds);
+  OopStorageSet::strong_oops_do(cl);
+  WeakProcessor::oops_do(cl);
+  Threads::oops_do(cl, &blobs);
+}
+
+void EpsilonHeap::walk_bitmap(ObjectClosure* cl) {
+  HeapWord* limit = _space->top();
+  HeapWord* addr = _bitmap.get_next_marked_addr(_space->bottom(), limit);
+  while (addr < limit) {
+    oop obj = cast_to_oop(addr);
+    assert(_bitmap.is_marked(obj), "sanity");
+    cl->do_object(obj);
+    addr = _bitmap.get_next_marked_addr(addr + 1, limit);
+  }
+}
+
+void EpsilonHeap::entry_collect(GCCause::Cause cause) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  assert(EpsilonSlidingGC, "must be enabled");
+
+  if (GCLocker::check_active_before_gc()) {
+    return;
+  }
+
+  GCIdMark gc_id_mark;
+  GCTraceTime(Info, gc) time("Pause Sliding Mark-Compact", NULL, cause, true);
+  SvcGCMarker sgcm(SvcGCMarker::FULL);
+  IsGCActiveMark active_gc_mark;
+  TraceMemoryManagerStats tms(&_memory_manager, cause);
+
+  increment_total_collections(true /* full */);
+
+  // Commit the bitmap for this collection only. Freshly committed memory is
+  // zeroed, so it does not need to be cleared.
+  if (!os::commit_memory((char*)_bitmap_region.start(), _bitmap_region.byte_size(), false)) {
+    log_warning(gc)("Could not commit native memory for marking bitmap, GC failed");
+    return;
+  }
+
+  size_t stat_reachable = 0;
+  size_t stat_moved = 0;
+  size_t stat_preserved_marks = 0;
+
+  {
+    GCTraceTime(Info, gc, phases) time("Prologue");
+
+    // Threads give up their TLABs, the walks below are bounded by top.
+    ensure_parsability(true);
+    BiasedLocking::preserve_marks();
+    COMPILER2_OR_JVMCI_PRESENT(DerivedPointerTable::clear());
+  }
+
+  {
+    GCTraceTime(Info, gc, phases) time("Mark");
+
+    EpsilonMarkStack stack;
+    EpsilonScanOopClosure cl(&stack, &_bitmap);
+
+    process_roots(&cl);
+    while (!stack.is_empty()) {
+      oop obj = stack.pop();
+      obj->oop_iterate(&cl);
+      stat_reachable++;
+    }
+
+    // Stack locations of derived pointers are only recorded during marking.
+    COMPILER2_OR_JVMCI_PRESENT(DerivedPointerTable::set_active(false));
+  }
+
+  // The forwarding information overwrites the mark words, keep the ones
+  // that need to be restored after the move.
+  PreservedMarks preserved_marks;
+  HeapWord* new_top;
+
+  {
+    GCTraceTime(Info, gc, phases) time("Calculate new locations");
+
+    EpsilonCalcNewLocationObjectClosure cl(_space->bottom(), &preserved_marks);
+    walk_bitmap(&cl);
+
+    // Top is only lowered after the move, as the walks are bounded by it.
+    new_top = cl.compact_point();
+    stat_preserved_marks = preserved_marks.size();
+  }
+
+  {
+    GCTraceTime(Info, gc, phases) time("Adjust pointers");
+
+    EpsilonAdjustPointersObjectClosure cl;
+    walk_bitmap(&cl);
+
+    EpsilonAdjustPointersOopClosure cli;
+    process_roots(&cli);
+
+    preserved_marks.adjust_during_full_gc();
+  }
+
+  {
+    GCTraceTime(Info, gc, phases) time("Move objects");
+
+    EpsilonMoveObjectsObjectClosure cl;
+    walk_bitmap(&cl);
+    stat_moved = cl.moved();
+
+    _space->set_top(new_top);
+  }
+
+  {
+    GCTraceTime(Info, gc, phases) time("Epilogue");
+
+    preserved_marks.restore();
+    COMPILER2_OR_JVMCI_PRESENT(DerivedPointerTable::update_pointers());
+    BiasedLocking::restore_marks();
+    // Objects have moved, so address-based tables need rehashing.
+    JVMTI_ONLY(JvmtiTagMap::set_needs_rehashing();)
+
+    if (!os::uncommit_memory((char*)_bitmap_region.start(), _bitmap_region.byte_size())) {
+      log_warning(gc)("Could not uncommit native memory for marking bitmap");
+    }
+  }
+
+  size_t new_used = used();
+  _last_counter_update = new_used;
+  _last_heap_print = new_used;
+  _monitoring_support->update_counters();
+
+  log_info(gc)("GC stats: " SIZE_FORMAT " reachable, " SIZE_FORMAT " moved, " SIZE_FORMAT " preserved marks",
+               stat_reachable, stat_moved, stat_preserved_marks);
+  print_heap_info(new_used);
+  print_metaspace_info();
+}
+
 void EpsilonHeap::print_on(outputStream *st) const {
   st->print_cr("Epsilon Heap");
 
@@ -86,7 +86,13 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(bool, EpsilonSlidingGC, false, EXPERIMENTAL,                      \
+          "Perform a single-threaded, stop-the-world sliding mark-compact " \
+          "collection when the heap is exhausted, instead of failing with " \
+          "OutOfMemoryError. All weak references are treated as strong, "   \
+          "so nothing reachable through them is reclaimed.")
 
 // end of GC_EPSILON_FLAGS
 
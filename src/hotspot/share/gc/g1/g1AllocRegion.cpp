@@ -110,6 +110,10 @@ size_t G1AllocRegion::retire_internal(HeapRegion* alloc_region, bool fill_up) {
 
   assert_alloc_region(alloc_region->used() >= _used_bytes_before, "invariant");
   size_t allocated_bytes = alloc_region->used() - _used_bytes_before;
+  if (_bot_updates) {
+    // Parallel allocations did not keep the BOT threshold up to date.
+    alloc_region->update_bot_threshold();
+  }
   retire_region(alloc_region, allocated_bytes);
   _used_bytes_before = 0;
 
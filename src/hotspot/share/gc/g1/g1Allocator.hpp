@@ -46,7 +46,8 @@ private:
   bool _survivor_is_full;
   bool _old_is_full;
 
-  // The number of MutatorAllocRegions used, one per memory node.
+  // The number of MutatorAllocRegions, SurvivorGCAllocRegions and
+  // OldGCAllocRegions used, one each per memory node.
   size_t _num_alloc_regions;
 
   // Alloc region used to satisfy mutator allocation requests.
@@ -58,9 +59,10 @@ private:
 
   // Alloc region used to satisfy allocation requests by the GC for
   // old objects.
-  OldGCAllocRegion _old_gc_alloc_region;
+  OldGCAllocRegion* _old_gc_alloc_regions;
 
-  HeapRegion* _retained_old_gc_alloc_region;
+  // Old GC alloc regions retained across GCs, one per memory node.
+  HeapRegion** _retained_old_gc_alloc_regions;
 
   bool survivor_is_full() const;
   bool old_is_full() const;
@@ -68,14 +70,14 @@ private:
   void set_survivor_full();
   void set_old_full();
 
-  void reuse_retained_old_region(G1EvacuationInfo& evacuation_info,
-                                 OldGCAllocRegion* old,
-                                 HeapRegion** retained);
+  // Returns the number of bytes used in the retained region if it is reused.
+  size_t reuse_retained_old_region(OldGCAllocRegion* old,
+                                   HeapRegion** retained);
 
   // Accessors to the allocation regions.
   inline MutatorAllocRegion* mutator_alloc_region(uint node_index);
   inline SurvivorGCAllocRegion* survivor_gc_alloc_region(uint node_index);
-  inline OldGCAllocRegion* old_gc_alloc_region();
+  inline OldGCAllocRegion* old_gc_alloc_region(uint node_index);
 
   // Allocation attempt during GC for a survivor object / PLAB.
   HeapWord* survivor_attempt_allocation(size_t min_word_size,
@@ -86,7 +88,8 @@ private:
   // Allocation attempt during GC for an old object / PLAB.
   HeapWord* old_attempt_allocation(size_t min_word_size,
                                    size_t desired_word_size,
-                                   size_t* actual_word_size);
+                                   size_t* actual_word_size,
+                                   uint node_index);
 
   // Node index of current thread.
   inline uint current_node_index() const;
@@ -166,8 +169,7 @@ private:
   inline PLAB* alloc_buffer(region_type_t dest, uint node_index) const;
 
   // Returns the number of allocation buffers for the given dest.
-  // There is only 1 buffer for Old while Young may have multiple buffers depending on
-  // active NUMA nodes.
+  // Young and Old may have multiple buffers depending on active NUMA nodes.
   inline uint alloc_buffers_length(region_type_t dest) const;
 
   bool may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const;
@@ -257,6 +257,12 @@ double G1Analytics::predict_card_merge_time_ms(size_t card_num, bool for_young_g
   }
 }
 
+bool G1Analytics::enough_young_card_cost_samples_available() const {
+  return enough_samples_available(_young_cost_per_card_merge_ms_seq) &&
+         enough_samples_available(_young_cost_per_card_scan_ms_seq) &&
+         enough_samples_available(_young_card_merge_to_scan_ratio_seq);
+}
+
 double G1Analytics::predict_card_scan_time_ms(size_t card_num, bool for_young_gc) const {
   if (for_young_gc || !enough_samples_available(_mixed_cost_per_card_scan_ms_seq)) {
     return card_num * predict_zero_bounded(_young_cost_per_card_scan_ms_seq);
@@ -147,6 +147,9 @@ public:
 
   double predict_card_merge_time_ms(size_t card_num, bool for_young_gc) const;
   double predict_card_scan_time_ms(size_t card_num, bool for_young_gc) const;
+  // Whether the young card merge and scan cost predictions are based on
+  // enough measurements rather than mostly on the initial defaults.
+  bool enough_young_card_cost_samples_available() const;
 
   double predict_object_copy_time_ms_during_cm(size_t bytes_to_copy) const;
 
@@ -337,6 +337,28 @@ void G1BlockOffsetTablePart::alloc_block_work(HeapWord** threshold_, size_t* ind
 #endif
 }
 
+void G1BlockOffsetTablePart::par_alloc_block(HeapWord* blk, size_t size) {
+  HeapWord* blk_end = blk + size;
+  size_t index = _bot->index_for(blk) + !_bot->is_card_boundary(blk);
+  HeapWord* threshold = _bot->address_for_index_raw(index);
+  if (blk_end > threshold) {
+    alloc_block_work(&threshold, &index, blk, blk_end);
+  }
+}
+
+void G1BlockOffsetTablePart::update_threshold() {
+  HeapWord* const top = _hr->top();
+  if (top == _hr->bottom()) {
+    return;
+  }
+  // The block containing top - 1 has updated all cards up to and including
+  // the one it ends in.
+  size_t index = _bot->index_for(top - 1) + 1;
+  assert(index >= _next_offset_index, "threshold must not move backwards");
+  _next_offset_index = index;
+  _next_offset_threshold = _bot->address_for_index_raw(index);
+}
+
 void G1BlockOffsetTablePart::verify() const {
   assert(_hr->bottom() < _hr->top(), "Only non-empty regions should be verified.");
   size_t start_card = _bot->index_for(_hr->bottom());
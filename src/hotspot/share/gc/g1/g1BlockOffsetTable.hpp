@@ -225,6 +225,16 @@ public:
     alloc_block(blk, blk+size);
   }
 
+  // Variant of alloc_block() for blocks allocated concurrently by multiple
+  // threads. The cards to update are found from the block itself instead of
+  // the threshold, which is left untouched; blocks never share such cards
+  // so no synchronization is needed. update_threshold() must be called
+  // before the next threshold based operation.
+  void par_alloc_block(HeapWord* blk, size_t size);
+
+  // Sets the threshold to the first card boundary at or above top.
+  void update_threshold();
+
   void set_for_starts_humongous(HeapWord* obj_top, size_t fill_size);
   void set_object_can_span(bool can_span) NOT_DEBUG_RETURN;
 
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardSet.inline.hpp"
+#include "gc/g1/g1CardSetContainers.hpp"
+#include "gc/g1/g1_globals.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "gc/g1/heapRegionBounds.inline.hpp"
+#include "gc/shared/cardTable.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+uint G1CardSet::_cards_in_region = 0;
+uint G1CardSet::_max_cards_in_array = 0;
+uint G1CardSet::_max_bitmaps = 0;
+uint G1CardSet::_cards_in_bitmap_to_coarsen = 0;
+
+size_t volatile G1CardSet::_num_coarsenings = 0;
+
+void G1CardSet::initialize() {
+  // Check that the card array element type can represent all cards in the region.
+  assert(((size_t)1 << (sizeof(card_elem_t) * BitsPerByte)) *
+         CardTable::card_size >= HeapRegionBounds::max_size(), "precondition");
+  assert(G1RSetSparseRegionEntries > 0 && G1RSetRegionEntries > 0, "precondition");
+
+  _cards_in_region = (uint)HeapRegion::CardsPerRegion;
+  _max_cards_in_array = MIN2((uint)G1RSetSparseRegionEntries, _cards_in_region);
+  _max_bitmaps = (uint)G1RSetRegionEntries;
+  _cards_in_bitmap_to_coarsen = MAX2((uint)((size_t)_cards_in_region * G1RemSetCoarsenBitMapToFullPercent / 100), 1u);
+}
+
+G1CardSet::G1CardSet(Mutex* m) :
+  _m(m),
+  _table(NULL),
+  _retired_tables(NULL),
+  _retired_bitmaps(NULL),
+  _num_entries(0),
+  _num_bitmaps(0),
+  _num_full(0),
+  _mem_size(0),
+  _num_occupied(0) {
+}
+
+G1CardSet::~G1CardSet() {
+  clear();
+}
+
+void G1CardSet::free_container(ContainerPtr container) {
+  switch (container_type(container)) {
+    case ContainerFull:
+      break;
+    case ContainerBitMap:
+      _mem_size -= G1CardSetBitMap::size_in_bytes(_cards_in_region);
+      G1CardSetBitMap::destroy(container_bitmap(container));
+      break;
+    case ContainerArray: {
+      G1CardSetArray* array = container_array(container);
+      _mem_size -= G1CardSetArray::size_in_bytes(array->capacity());
+      G1CardSetArray::destroy(array);
+      break;
+    }
+    default:
+      ShouldNotReachHere();
+  }
+}
+
+void G1CardSet::maybe_grow_table_locked() {
+  assert(_m->owned_by_self(), "must be");
+  G1CardSetBuckets* old_table = _table;
+  if (old_table == NULL) {
+    G1CardSetBuckets* new_table = G1CardSetBuckets::create(InitialNumBuckets);
+    _mem_size += G1CardSetBuckets::size_in_bytes(InitialNumBuckets);
+    Atomic::release_store(&_table, new_table);
+    return;
+  }
+  if (_num_entries < old_table->num_buckets() * MaxEntriesPerBucket) {
+    return;
+  }
+
+  uint new_num_buckets = old_table->num_buckets() * 2;
+  G1CardSetBuckets* new_table = G1CardSetBuckets::create(new_num_buckets);
+  _mem_size += G1CardSetBuckets::size_in_bytes(new_num_buckets);
+
+  // Relink all entries into the new table. Concurrent lock-free readers may
+  // still walk the old table and be sent to a collision list of the new table
+  // by an already relinked entry. Every collision list stays NULL-terminated,
+  // so such a reader at worst fails to find its entry and retries under the lock.
+  for (uint i = 0; i < old_table->num_buckets(); i++) {
+    G1CardSetEntry* cur = old_table->bucket(i);
+    while (cur != NULL) {
+      G1CardSetEntry* next = cur->next();
+      uint idx = new_table->index_for(cur->region_idx());
+      cur->set_next(new_table->bucket(idx));
+      new_table->set_bucket(idx, cur);
+      cur = next;
+    }
+  }
+  Atomic::release_store(&_table, new_table);
+
+  old_table->set_next_retired(_retired_tables);
+  _retired_tables = old_table;
+}
+
+void G1CardSet::insert_entry_locked(uint region_idx, uint card_in_region) {
+  assert(_m->owned_by_self(), "must be");
+  assert(find_entry(region_idx) == NULL, "must not have entry for region %u yet", region_idx);
+
+  maybe_grow_table_locked();
+
+  G1CardSetArray* array = G1CardSetArray::create(InitialArrayCapacity);
+  array->add(card_in_region);
+  G1CardSetEntry* entry = new G1CardSetEntry(region_idx, (ContainerPtr)array, 1);
+  _mem_size += G1CardSetArray::size_in_bytes(InitialArrayCapacity) + sizeof(G1CardSetEntry);
+
+  G1CardSetBuckets* table = _table;
+  uint idx = table->index_for(region_idx);
+  entry->set_next(table->bucket(idx));
+  // The release store makes the fully initialized entry visible to concurrent readers.
+  table->set_bucket(idx, entry);
+
+  _num_entries++;
+  Atomic::inc(&_num_occupied, memory_order_relaxed);
+}
+
+void G1CardSet::coarsen_to_full_locked(G1CardSetEntry* entry) {
+  assert(_m->owned_by_self(), "must be");
+  ContainerPtr container = entry->container();
+  if (container_type(container) == ContainerFull) {
+    // Some other thread coarsened this container in the meantime.
+    return;
+  }
+  entry->set_container(FullCardSet);
+  uint num_cards = Atomic::xchg(entry->num_cards_addr(), _cards_in_region);
+  Atomic::add(&_num_occupied, (size_t)(_cards_in_region - MIN2(num_cards, _cards_in_region)), memory_order_relaxed);
+
+  if (container_type(container) == ContainerBitMap) {
+    // Concurrent threads may still be setting bits in this bitmap. Keep it around
+    // until the card set is cleared.
+    G1CardSetBitMap* bitmap = container_bitmap(container);
+    bitmap->set_next_retired(_retired_bitmaps);
+    _retired_bitmaps = bitmap;
+    _num_bitmaps--;
+  } else {
+    free_container(container);
+  }
+  _num_full++;
+  Atomic::inc(&_num_coarsenings);
+}
+
+void G1CardSet::transfer_array_to_bitmap_locked(G1CardSetEntry* entry, G1CardSetArray* array, uint card_in_region) {
+  assert(_m->owned_by_self(), "must be");
+  if (_num_bitmaps >= _max_bitmaps) {
+    coarsen_to_full_locked(entry);
+    return;
+  }
+
+  G1CardSetBitMap* bitmap = G1CardSetBitMap::create(_cards_in_region);
+  _mem_size += G1CardSetBitMap::size_in_bytes(_cards_in_region);
+  BitMapView bm = bitmap->bitmap(_cards_in_region);
+  for (uint i = 0; i < array->num_cards(); i++) {
+    bm.set_bit(array->card(i));
+  }
+  bm.set_bit(card_in_region);
+
+  Atomic::inc(entry->num_cards_addr(), memory_order_relaxed);
+  Atomic::inc(&_num_occupied, memory_order_relaxed);
+  entry->set_container((ContainerPtr)bitmap | ContainerBitMap);
+  _num_bitmaps++;
+
+  // Array containers are only accessed under the lock, so it can be freed right away.
+  free_container((ContainerPtr)array);
+
+  if (should_coarsen_bitmap(entry)) {
+    coarsen_to_full_locked(entry);
+  }
+}
+
+G1CardSet::AddCardResult G1CardSet::add_to_array_locked(G1CardSetEntry* entry, uint card_in_region) {
+  assert(_m->owned_by_self(), "must be");
+  G1CardSetArray* array = container_array(entry->container());
+  if (array->contains(card_in_region)) {
+    return Found;
+  }
+  if (!array->is_full()) {
+    array->add(card_in_region);
+    Atomic::inc(entry->num_cards_addr(), memory_order_relaxed);
+    Atomic::inc(&_num_occupied, memory_order_relaxed);
+    return Added;
+  }
+  if (array->capacity() < _max_cards_in_array) {
+    // Grow the array container.
+    uint new_capacity = MIN2(array->capacity() * 2, _max_cards_in_array);
+    G1CardSetArray* new_array = G1CardSetArray::create(new_capacity);
+    _mem_size += G1CardSetArray::size_in_bytes(new_capacity);
+    array->copy_cards_to(new_array);
+    new_array->add(card_in_region);
+    Atomic::inc(entry->num_cards_addr(), memory_order_relaxed);
+    Atomic::inc(&_num_occupied, memory_order_relaxed);
+    entry->set_container((ContainerPtr)new_array);
+    free_container((ContainerPtr)array);
+    return Added;
+  }
+  transfer_array_to_bitmap_locked(entry, array, card_in_region);
+  return Added;
+}
+
+G1CardSet::AddCardResult G1CardSet::add_card_locked(uint region_idx, uint card_in_region) {
+  assert(_m->owned_by_self(), "must be");
+  G1CardSetEntry* entry = find_entry(region_idx);
+  if (entry == NULL) {
+    insert_entry_locked(region_idx, card_in_region);
+    return Added;
+  }
+
+  ContainerPtr container = entry->container();
+  switch (container_type(container)) {
+    case ContainerFull:
+      return Found;
+    case ContainerBitMap: {
+      AddCardResult result = add_to_bitmap(entry, container, card_in_region);
+      if (result == Added && should_coarsen_bitmap(entry)) {
+        coarsen_to_full_locked(entry);
+      }
+      return result;
+    }
+    case ContainerArray:
+      return add_to_array_locked(entry, card_in_region);
+    default:
+      ShouldNotReachHere();
+      return Found;
+  }
+}
+
+G1CardSet::AddCardResult G1CardSet::add_card(uint region_idx, uint card_in_region) {
+  assert(card_in_region < _cards_in_region, "card %u out of bounds %u", card_in_region, _cards_in_region);
+
+  // Fast path: full and bitmap containers can be updated without taking the lock.
+  G1CardSetEntry* entry = find_entry(region_idx);
+  if (entry != NULL) {
+    ContainerPtr container = entry->container();
+    if (container_type(container) == ContainerFull) {
+      return Found;
+    } else if (container_type(container) == ContainerBitMap) {
+      AddCardResult result = add_to_bitmap(entry, container, card_in_region);
+      if (result == Added && should_coarsen_bitmap(entry)) {
+        MutexLocker ml(_m, Mutex::_no_safepoint_check_flag);
+        coarsen_to_full_locked(entry);
+      }
+      return result;
+    }
+  }
+
+  MutexLocker ml(_m, Mutex::_no_safepoint_check_flag);
+  return add_card_locked(region_idx, card_in_region);
+}
+
+bool G1CardSet::contains_card(uint region_idx, uint card_in_region) const {
+  assert(card_in_region < _cards_in_region, "card %u out of bounds %u", card_in_region, _cards_in_region);
+  G1CardSetEntry* entry = find_entry(region_idx);
+  if (entry == NULL) {
+    return false;
+  }
+  ContainerPtr container = entry->container();
+  switch (container_type(container)) {
+    case ContainerFull:
+      return true;
+    case ContainerBitMap:
+      return container_bitmap(container)->bitmap(_cards_in_region).at(card_in_region);
+    case ContainerArray:
+      return container_array(container)->contains(card_in_region);
+    default:
+      ShouldNotReachHere();
+      return false;
+  }
+}
+
+void G1CardSet::clear() {
+  G1CardSetBuckets* table = _table;
+  if (table != NULL) {
+    for (uint i = 0; i < table->num_buckets(); i++) {
+      G1CardSetEntry* cur = table->bucket(i);
+      while (cur != NULL) {
+        G1CardSetEntry* next = cur->next();
+        free_container(cur->container());
+        delete cur;
+        cur = next;
+      }
+    }
+    G1CardSetBuckets::destroy(table);
+    Atomic::store(&_table, (G1CardSetBuckets*)NULL);
+  }
+  while (_retired_tables != NULL) {
+    G1CardSetBuckets* next = _retired_tables->next_retired();
+    G1CardSetBuckets::destroy(_retired_tables);
+    _retired_tables = next;
+  }
+  while (_retired_bitmaps != NULL) {
+    G1CardSetBitMap* next = _retired_bitmaps->next_retired();
+    G1CardSetBitMap::destroy(_retired_bitmaps);
+    _retired_bitmaps = next;
+  }
+
+  _num_entries = 0;
+  _num_bitmaps = 0;
+  _num_full = 0;
+  _mem_size = 0;
+  Atomic::store(&_num_occupied, (size_t)0);
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSET_HPP
+#define SHARE_GC_G1_G1CARDSET_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/bitMap.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class G1CardSetArray;
+class G1CardSetBitMap;
+class G1CardSetBuckets;
+class G1CardSetEntry;
+class Mutex;
+
+// A G1CardSet is the set of cards (in other regions) that may contain references
+// into the region owning the card set. Cards are grouped by the region they are
+// located in (the "source region"). For every source region the card set keeps
+// exactly one container, whose representation is chosen by the number of cards
+// recorded for that source region:
+//
+//   - Array container: a small array of card indices, sized to the number of
+//     cards actually recorded. Every source region starts with an array
+//     container; it may hold up to G1RSetSparseRegionEntries cards.
+//   - BitMap container: one bit per card in the source region. Array containers
+//     overflowing G1RSetSparseRegionEntries are converted to bitmaps.
+//   - Full container: all cards of the source region must be scanned. BitMap
+//     containers with an occupancy above G1RemSetCoarsenBitMapToFullPercent are
+//     converted to full containers, as are array containers that would need a
+//     bitmap when there are already G1RSetRegionEntries bitmaps. Full containers
+//     do not use any memory beyond their entry.
+//
+// Entries for source regions are kept in a hash table keyed by region index,
+// grown on demand.
+//
+// Lookup of entries and additions to bitmap and full containers are lock-free.
+// All other modifications, i.e. adding entries, adding cards to array containers
+// and changing the type of a container are serialized by the given mutex.
+// Memory that concurrent lock-free readers may still access (entries, previous
+// bucket arrays and previous bitmap containers) is only freed in clear(), which
+// must not be called concurrently with any other operation on the card set.
+class G1CardSet : public CHeapObj<mtGC> {
+  friend class G1CardSetTest;
+
+public:
+  // The type used to store a card index within its source region in array
+  // containers.
+  typedef uint16_t card_elem_t;
+
+  // A container is a pointer to the container memory, with the container type
+  // encoded in the lower bits.
+  typedef uintptr_t ContainerPtr;
+
+  enum ContainerType {
+    ContainerArray  = 0x0,
+    ContainerBitMap = 0x1,
+    ContainerFull   = 0x3
+  };
+
+  enum AddCardResult {
+    Found,    // The card was already in the card set.
+    Added     // The card has been added.
+  };
+
+private:
+  static const uintptr_t ContainerTypeMask = 0x3;
+  static const ContainerPtr FullCardSet = ContainerFull;
+
+  // Number of buckets of the first bucket array.
+  static const uint InitialNumBuckets = 4;
+  // Average number of entries per bucket that triggers growing the bucket array.
+  static const uint MaxEntriesPerBucket = 2;
+  // Capacity of the first array container for a source region.
+  static const uint InitialArrayCapacity = 4;
+
+  // Static configuration, set up in initialize().
+  static uint _cards_in_region;
+  static uint _max_cards_in_array;
+  static uint _max_bitmaps;
+  static uint _cards_in_bitmap_to_coarsen;
+
+  // Total number of containers converted to full containers.
+  static size_t volatile _num_coarsenings;
+
+  Mutex* _m;
+
+  G1CardSetBuckets* volatile _table;
+
+  // Lists of memory that is not referenced by the card set any more, but may
+  // still be accessed by concurrent readers. Protected by _m.
+  G1CardSetBuckets* _retired_tables;
+  G1CardSetBitMap* _retired_bitmaps;
+
+  // Statistics, all protected by _m.
+  uint _num_entries;
+  uint _num_bitmaps;
+  uint _num_full;
+  size_t _mem_size;
+
+  // Approximation of the number of cards in this card set. Concurrent additions
+  // to bitmap containers that are being converted to full containers may make
+  // this value larger than the real number of cards.
+  size_t volatile _num_occupied;
+
+  static ContainerType container_type(ContainerPtr container) {
+    return (ContainerType)(container & ContainerTypeMask);
+  }
+  static G1CardSetArray* container_array(ContainerPtr container);
+  static G1CardSetBitMap* container_bitmap(ContainerPtr container);
+
+  // Lock-free lookup of the entry for the given source region. Returns NULL if
+  // no entry is found; the caller must retry under the lock in this case as
+  // the table may be concurrently grown.
+  inline G1CardSetEntry* find_entry(uint region_idx) const;
+
+  // Inserts a new entry for the given source region containing the given card.
+  // Requires that _m is held and that there is no such entry yet.
+  void insert_entry_locked(uint region_idx, uint card_in_region);
+  void maybe_grow_table_locked();
+
+  AddCardResult add_card_locked(uint region_idx, uint card_in_region);
+  AddCardResult add_to_array_locked(G1CardSetEntry* entry, uint card_in_region);
+  inline AddCardResult add_to_bitmap(G1CardSetEntry* entry, ContainerPtr container, uint card_in_region);
+  inline bool should_coarsen_bitmap(G1CardSetEntry* entry) const;
+
+  // Convert the container of the given entry into a bitmap (or a full container
+  // if there are too many bitmap containers already) and add the given card.
+  void transfer_array_to_bitmap_locked(G1CardSetEntry* entry, G1CardSetArray* array, uint card_in_region);
+  void coarsen_to_full_locked(G1CardSetEntry* entry);
+
+  void free_container(ContainerPtr container);
+
+public:
+  G1CardSet(Mutex* m);
+  ~G1CardSet();
+
+  // Set up static configuration based on region size and flags.
+  static void initialize();
+
+  static size_t num_coarsenings() { return Atomic::load(&_num_coarsenings); }
+
+  // Adds the given card of the given source region to the card set.
+  AddCardResult add_card(uint region_idx, uint card_in_region);
+
+  // Returns whether the given card of the given source region is in the card set.
+  bool contains_card(uint region_idx, uint card_in_region) const;
+
+  // Iterate over all containers of this card set, calling one of the following
+  // methods of the given closure for every container:
+  //
+  // next_full_container(uint region_idx) - for full containers
+  // next_bitmap_container(uint region_idx, BitMap* bitmap) - for bitmap containers
+  // next_array_container(uint region_idx, card_elem_t* cards, uint num_cards) - for array containers
+  //
+  // Must not be called concurrently with any modification of the card set.
+  template <class Closure>
+  inline void iterate_containers(Closure& cl);
+
+  // Returns the number of cards contained in this card set.
+  size_t occupied() const { return Atomic::load(&_num_occupied); }
+  bool is_empty() const { return occupied() == 0; }
+
+  uint num_entries() const { return _num_entries; }
+  uint num_bitmap_containers() const { return _num_bitmaps; }
+  uint num_full_containers() const { return _num_full; }
+  uint num_array_containers() const { return _num_entries - _num_bitmaps - _num_full; }
+
+  // Returns the size of the card set in bytes, including memory not yet freed.
+  size_t mem_size() const { return sizeof(*this) + _mem_size; }
+
+  // Clears the card set and frees all memory. Must not be called concurrently
+  // with any other operation on the card set.
+  void clear();
+};
+
+#endif // SHARE_GC_G1_G1CARDSET_HPP
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSET_INLINE_HPP
+#define SHARE_GC_G1_G1CARDSET_INLINE_HPP
+
+#include "gc/g1/g1CardSet.hpp"
+
+#include "gc/g1/g1CardSetContainers.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/bitMap.inline.hpp"
+
+inline G1CardSetArray* G1CardSet::container_array(ContainerPtr container) {
+  assert(container_type(container) == ContainerArray, "must be");
+  return (G1CardSetArray*)container;
+}
+
+inline G1CardSetBitMap* G1CardSet::container_bitmap(ContainerPtr container) {
+  assert(container_type(container) == ContainerBitMap, "must be");
+  return (G1CardSetBitMap*)(container & ~ContainerTypeMask);
+}
+
+inline G1CardSetEntry* G1CardSet::find_entry(uint region_idx) const {
+  G1CardSetBuckets* table = Atomic::load_acquire(&_table);
+  if (table == NULL) {
+    return NULL;
+  }
+  G1CardSetEntry* cur = table->bucket(table->index_for(region_idx));
+  while (cur != NULL && cur->region_idx() != region_idx) {
+    cur = cur->next();
+  }
+  return cur;
+}
+
+inline bool G1CardSet::should_coarsen_bitmap(G1CardSetEntry* entry) const {
+  return entry->num_cards() >= _cards_in_bitmap_to_coarsen;
+}
+
+inline G1CardSet::AddCardResult G1CardSet::add_to_bitmap(G1CardSetEntry* entry,
+                                                         ContainerPtr container,
+                                                         uint card_in_region) {
+  BitMapView bm = container_bitmap(container)->bitmap(_cards_in_region);
+  if (!bm.par_set_bit(card_in_region)) {
+    return Found;
+  }
+  Atomic::inc(entry->num_cards_addr(), memory_order_relaxed);
+  Atomic::inc(&_num_occupied, memory_order_relaxed);
+  return Added;
+}
+
+template <class Closure>
+inline void G1CardSet::iterate_containers(Closure& cl) {
+  G1CardSetBuckets* table = Atomic::load_acquire(&_table);
+  if (table == NULL) {
+    return;
+  }
+  for (uint i = 0; i < table->num_buckets(); i++) {
+    for (G1CardSetEntry* cur = table->bucket(i); cur != NULL; cur = cur->next()) {
+      ContainerPtr container = cur->container();
+      switch (container_type(container)) {
+        case ContainerFull: {
+          cl.next_full_container(cur->region_idx());
+          break;
+        }
+        case ContainerBitMap: {
+          BitMapView bm = container_bitmap(container)->bitmap(_cards_in_region);
+          cl.next_bitmap_container(cur->region_idx(), &bm);
+          break;
+        }
+        case ContainerArray: {
+          G1CardSetArray* array = container_array(container);
+          cl.next_array_container(cur->region_idx(), array->cards(), array->num_cards());
+          break;
+        }
+        default:
+          ShouldNotReachHere();
+      }
+    }
+  }
+}
+
+#endif // SHARE_GC_G1_G1CARDSET_INLINE_HPP
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDSETCONTAINERS_HPP
+#define SHARE_GC_G1_G1CARDSETCONTAINERS_HPP
+
+#include "gc/g1/g1CardSet.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/align.hpp"
+#include "utilities/bitMap.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+// Array container of a G1CardSet: an unordered array of card indices within the
+// source region. All accesses must be serialized by the owning card set's lock
+// or happen at a safepoint.
+class G1CardSetArray {
+  uint _num_cards;
+  uint _capacity;
+  // The actual cards stored in this array.
+  // WARNING: Don't put any data members beyond this line. Card array has, in fact, variable length.
+  // It should always be the last data member.
+  G1CardSet::card_elem_t _cards[2];
+
+  G1CardSetArray(uint capacity) : _num_cards(0), _capacity(capacity) { }
+
+public:
+  static size_t size_in_bytes(uint capacity) {
+    return align_up(offset_of(G1CardSetArray, _cards) + capacity * sizeof(G1CardSet::card_elem_t),
+                    sizeof(G1CardSetArray*));
+  }
+
+  static G1CardSetArray* create(uint capacity) {
+    void* mem = NEW_C_HEAP_ARRAY(char, size_in_bytes(capacity), mtGC);
+    return ::new (mem) G1CardSetArray(capacity);
+  }
+
+  static void destroy(G1CardSetArray* array) {
+    FREE_C_HEAP_ARRAY(char, array);
+  }
+
+  uint num_cards() const { return _num_cards; }
+  uint capacity() const { return _capacity; }
+  bool is_full() const { return _num_cards == _capacity; }
+
+  G1CardSet::card_elem_t* cards() { return _cards; }
+
+  G1CardSet::card_elem_t card(uint i) const {
+    assert(i < _num_cards, "index %u out of bounds %u", i, _num_cards);
+    return _cards[i];
+  }
+
+  bool contains(uint card_in_region) const {
+    for (uint i = 0; i < _num_cards; i++) {
+      if (_cards[i] == card_in_region) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void add(uint card_in_region) {
+    assert(!is_full(), "must be");
+    _cards[_num_cards++] = (G1CardSet::card_elem_t)card_in_region;
+  }
+
+  void copy_cards_to(G1CardSetArray* other) const {
+    assert(other->capacity() >= _num_cards, "must fit");
+    memcpy(other->_cards, _cards, _num_cards * sizeof(G1CardSet::card_elem_t));
+    other->_num_cards = _num_cards;
+  }
+};
+
+// BitMap container of a G1CardSet: one bit per card in the source region. Bits
+// may be set concurrently.
+class G1CardSetBitMap {
+  G1CardSetBitMap* _next_retired;
+  // WARNING: Don't put any data members beyond this line. The bits array has,
+  // in fact, variable length.
+  BitMap::bm_word_t _bits[1];
+
+  G1CardSetBitMap() : _next_retired(NULL) { }
+
+public:
+  static size_t size_in_bytes(uint cards_in_region) {
+    return offset_of(G1CardSetBitMap, _bits) + BitMap::calc_size_in_words(cards_in_region) * BytesPerWord;
+  }
+
+  static G1CardSetBitMap* create(uint cards_in_region) {
+    void* mem = NEW_C_HEAP_ARRAY(char, size_in_bytes(cards_in_region), mtGC);
+    G1CardSetBitMap* result = ::new (mem) G1CardSetBitMap();
+    result->bitmap(cards_in_region).clear();
+    return result;
+  }
+
+  static void destroy(G1CardSetBitMap* bitmap) {
+    FREE_C_HEAP_ARRAY(char, bitmap);
+  }
+
+  BitMapView bitmap(uint cards_in_region) { return BitMapView(_bits, cards_in_region); }
+
+  G1CardSetBitMap* next_retired() const { return _next_retired; }
+  void set_next_retired(G1CardSetBitMap* next) { _next_retired = next; }
+};
+
+// The entry for a single source region of a G1CardSet.
+class G1CardSetEntry : public CHeapObj<mtGC> {
+  uint _region_idx;
+  // Number of cards in the container of this entry.
+  uint volatile _num_cards;
+  G1CardSet::ContainerPtr volatile _container;
+  // Next entry in the hash bucket's collision list.
+  G1CardSetEntry* volatile _next;
+
+public:
+  G1CardSetEntry(uint region_idx, G1CardSet::ContainerPtr container, uint num_cards) :
+    _region_idx(region_idx),
+    _num_cards(num_cards),
+    _container(container),
+    _next(NULL) { }
+
+  uint region_idx() const { return _region_idx; }
+
+  uint num_cards() const { return Atomic::load(&_num_cards); }
+  uint volatile* num_cards_addr() { return &_num_cards; }
+
+  G1CardSet::ContainerPtr container() const { return Atomic::load_acquire(&_container); }
+  // Publishes the new container; its contents must be fully initialized.
+  void set_container(G1CardSet::ContainerPtr container) { Atomic::release_store(&_container, container); }
+
+  G1CardSetEntry* next() const { return Atomic::load_acquire(&_next); }
+  void set_next(G1CardSetEntry* next) { Atomic::release_store(&_next, next); }
+};
+
+// The bucket array of the hash table of a G1CardSet. The number of buckets is
+// always a power of two.
+class G1CardSetBuckets {
+  G1CardSetBuckets* _next_retired;
+  uint _num_buckets;
+  // WARNING: Don't put any data members beyond this line. The bucket array has,
+  // in fact, variable length.
+  G1CardSetEntry* volatile _buckets[1];
+
+  G1CardSetBuckets(uint num_buckets) : _next_retired(NULL), _num_buckets(num_buckets) {
+    for (uint i = 0; i < num_buckets; i++) {
+      _buckets[i] = NULL;
+    }
+  }
+
+public:
+  static size_t size_in_bytes(uint num_buckets) {
+    return offset_of(G1CardSetBuckets, _buckets) + num_buckets * sizeof(G1CardSetEntry*);
+  }
+
+  static G1CardSetBuckets* create(uint num_buckets) {
+    assert(is_power_of_2(num_buckets), "must be");
+    void* mem = NEW_C_HEAP_ARRAY(char, size_in_bytes(num_buckets), mtGC);
+    return ::new (mem) G1CardSetBuckets(num_buckets);
+  }
+
+  static void destroy(G1CardSetBuckets* buckets) {
+    FREE_C_HEAP_ARRAY(char, buckets);
+  }
+
+  uint num_buckets() const { return _num_buckets; }
+
+  uint index_for(uint region_idx) const { return region_idx & (_num_buckets - 1); }
+
+  G1CardSetEntry* bucket(uint i) const { return Atomic::load_acquire(&_buckets[i]); }
+  void set_bucket(uint i, G1CardSetEntry* entry) { Atomic::release_store(&_buckets[i], entry); }
+
+  G1CardSetBuckets* next_retired() const { return _next_retired; }
+  void set_next_retired(G1CardSetBuckets* next) { _next_retired = next; }
+};
+
+#endif // SHARE_GC_G1_G1CARDSETCONTAINERS_HPP
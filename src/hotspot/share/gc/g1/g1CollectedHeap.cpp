@@ -1478,6 +1478,7 @@ G1CollectedHeap::G1CollectedHeap() :
   _task_queues(NULL),
   _num_regions_failed_evacuation(0),
   _regions_failed_evacuation(mtGC),
+  _evacuation_alloc_failed(false),
   _evacuation_failed_info_array(NULL),
   _preserved_marks_set(true /* in_c_heap */),
 #ifndef PRODUCT
@@ -2370,6 +2371,17 @@ bool G1CollectedHeap::is_archived_object(oop object) const {
   return object != NULL && heap_region_containing(object)->is_archive();
 }
 
+oop G1CollectedHeap::pin_object(JavaThread* thread, oop obj) {
+  assert(obj != NULL, "must not be NULL");
+  heap_region_containing(obj)->increment_pinned_object_count();
+  return obj;
+}
+
+void G1CollectedHeap::unpin_object(JavaThread* thread, oop obj) {
+  assert(obj != NULL, "must not be NULL");
+  heap_region_containing(obj)->decrement_pinned_object_count();
+}
+
 class PrintRegionClosure: public HeapRegionClosure {
   outputStream* _st;
 public:
@@ -2897,6 +2909,7 @@ void G1CollectedHeap::gc_tracer_report_gc_end(bool concurrent_operation_is_full_
                                               G1EvacuationInfo& evacuation_info) {
   _gc_tracer_stw->report_evacuation_info(&evacuation_info);
   _gc_tracer_stw->report_tenuring_threshold(_policy->tenuring_threshold());
+  _gc_tracer_stw->report_phase_worker_times(phase_times());
 
   _gc_timer_stw->register_gc_end();
   _gc_tracer_stw->report_gc_end(_gc_timer_stw->gc_end(),
@@ -3044,7 +3057,7 @@ void G1CollectedHeap::do_collection_pause_at_safepoint_helper(double target_paus
     }
 
     // Print the remainder of the GC log output.
-    if (evacuation_failed()) {
+    if (evacuation_alloc_failed()) {
       log_info(gc)("To-space exhausted");
     }
 
@@ -3089,6 +3102,10 @@ void G1CollectedHeap::preserve_mark_during_evac_failure(uint worker_id, oop obj,
   _preserved_marks_set.get(worker_id)->push_if_necessary(obj, m);
 }
 
+void G1CollectedHeap::preserve_mark_of_pinned_object(uint worker_id, oop obj, markWord m) {
+  _preserved_marks_set.get(worker_id)->push_if_necessary(obj, m);
+}
+
 bool G1ParEvacuateFollowersClosure::offer_termination() {
   EventGCPhaseParallel event;
   G1ParScanThreadState* const pss = par_scan_state();
@@ -3342,6 +3359,10 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       if (!region->rem_set()->is_complete()) {
         return false;
       }
+      // Objects pinned by JNI critical sections must stay where they are.
+      if (region->has_pinned_objects()) {
+        return false;
+      }
       // Candidate selection must satisfy the following constraints
       // while concurrent marking is in progress:
       //
@@ -3363,12 +3384,7 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
-      // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
-      //
-      // We also treat is_typeArray() objects specially, allowing them
+      // We treat is_typeArray() objects specially, allowing them
       // to be reclaimed even if allocated before the start of
       // concurrent mark.  For this we rely on mark stack insertion to
       // exclude is_typeArray() objects, preventing reclaiming an object
@@ -3377,9 +3393,20 @@ class G1PrepareEvacuationTask : public AbstractGangTask {
       // Frequent allocation and drop of large binary blobs is an
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
-
-      return obj->is_typeArray() &&
-             _g1h->is_potential_eager_reclaim_candidate(region);
+      //
+      // Humongous objects containing references are only nominated while
+      // no concurrent marking or remembered set rebuild is in progress,
+      // trivially meeting the constraints above. The remembered set entries
+      // such an object induced on other regions become stale after
+      // reclamation. This is fine, as is already the case for stale entries
+      // of regions freed during collection: remembered set scanning only
+      // looks at cards below the scan top of old and humongous regions,
+      // which always cover parsable objects.
+      if (!_g1h->is_potential_eager_reclaim_candidate(region)) {
+        return false;
+      }
+      return obj->is_typeArray() ||
+             (obj->is_objArray() && !_g1h->collector_state()->mark_or_rebuild_in_progress());
     }
 
   public:
@@ -3469,6 +3496,7 @@ void G1CollectedHeap::pre_evacuate_collection_set(G1EvacuationInfo& evacuation_i
 
   _expand_heap_after_alloc_failure = true;
   Atomic::store(&_num_regions_failed_evacuation, 0u);
+  Atomic::store(&_evacuation_alloc_failed, false);
 
   _regions_failed_evacuation.clear();
 
@@ -3700,7 +3728,9 @@ void G1CollectedHeap::evacuate_next_optional_regions(G1ParScanThreadStateSet* pe
 void G1CollectedHeap::evacuate_optional_collection_set(G1ParScanThreadStateSet* per_thread_states) {
   const double gc_start_time_ms = phase_times()->cur_collection_start_sec() * 1000.0;
 
-  while (!evacuation_failed() && _collection_set.optional_region_length() > 0) {
+  // Regions retained for pinned objects use no space, so they do not stop
+  // optional evacuation.
+  while (!evacuation_alloc_failed() && _collection_set.optional_region_length() > 0) {
 
     double time_used_ms = os::elapsedTime() * 1000.0 - gc_start_time_ms;
     double time_left_ms = MaxGCPauseMillis - time_used_ms;
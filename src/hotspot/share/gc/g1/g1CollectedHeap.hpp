@@ -866,10 +866,14 @@ public:
   // The parallel task queues
   G1ScannerTasksQueueSet *_task_queues;
 
-  // Number of regions evacuation failed in the current collection.
+  // Number of regions evacuation failed in the current collection, either
+  // because there was no space to copy objects to, or because they contain
+  // pinned objects.
   volatile uint _num_regions_failed_evacuation;
   // Records for every region on the heap whether evacuation failed for it.
   CHeapBitMap _regions_failed_evacuation;
+  // Whether evacuation failed for lack of space in the current collection.
+  volatile bool _evacuation_alloc_failed;
 
   EvacuationFailedInfo* _evacuation_failed_info_array;
 
@@ -878,6 +882,9 @@ public:
   // Preserve the mark of "obj", if necessary, in preparation for its mark
   // word being overwritten with a self-forwarding-pointer.
   void preserve_mark_during_evac_failure(uint worker_id, oop obj, markWord m);
+  // Same for an object retained in place because its region has pinned objects,
+  // without recording it as failed copy.
+  void preserve_mark_of_pinned_object(uint worker_id, oop obj, markWord m);
 
 #ifndef PRODUCT
   // Support for forcing evacuation failures. Analogous to
@@ -1146,8 +1153,13 @@ public:
   // Returns whether this collection actually executed.
   bool try_collect(GCCause::Cause cause);
 
-  // True iff an evacuation has failed in the most-recent collection.
+  // True iff an evacuation has failed in the most-recent collection. This
+  // includes regions retained because they contain pinned objects.
   inline bool evacuation_failed() const;
+  // True iff an evacuation has failed in the most-recent collection because
+  // there was no space to copy an object to.
+  inline bool evacuation_alloc_failed() const;
+  inline void notify_evacuation_alloc_failed();
   // True iff the given region encountered an evacuation failure in the most-recent
   // collection.
   inline bool evacuation_failed(uint region_idx) const;
@@ -1446,6 +1458,12 @@ public:
 
   virtual bool is_archived_object(oop object) const;
 
+  // Objects are pinned by counting pinned objects per region. Regions with
+  // pinned objects are not evacuated.
+  virtual bool supports_object_pinning() const { return true; }
+  virtual oop pin_object(JavaThread* thread, oop obj);
+  virtual void unpin_object(JavaThread* thread, oop obj);
+
   // The methods below are here for convenience and dispatch the
   // appropriate method depending on value of the given VerifyOption
   // parameter. The values for that parameter, and their meanings,
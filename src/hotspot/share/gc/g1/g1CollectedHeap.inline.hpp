@@ -180,10 +180,11 @@ void G1CollectedHeap::register_humongous_region_with_region_attr(uint index) {
 
 void G1CollectedHeap::register_region_with_region_attr(HeapRegion* r) {
   _region_attr.set_has_remset(r->hrm_index(), r->rem_set()->is_tracked());
+  _region_attr.set_is_pinned(r->hrm_index(), r->has_pinned_objects());
 }
 
 void G1CollectedHeap::register_old_region_with_region_attr(HeapRegion* r) {
-  _region_attr.set_in_old(r->hrm_index(), r->rem_set()->is_tracked());
+  _region_attr.set_in_old(r->hrm_index(), r->rem_set()->is_tracked(), r->has_pinned_objects());
   _rem_set->exclude_region_from_scan(r->hrm_index());
 }
 
@@ -195,6 +196,16 @@ bool G1CollectedHeap::evacuation_failed() const {
   return num_regions_failed_evacuation() > 0;
 }
 
+bool G1CollectedHeap::evacuation_alloc_failed() const {
+  return Atomic::load(&_evacuation_alloc_failed);
+}
+
+void G1CollectedHeap::notify_evacuation_alloc_failed() {
+  if (!evacuation_alloc_failed()) {
+    Atomic::store(&_evacuation_alloc_failed, true);
+  }
+}
+
 bool G1CollectedHeap::evacuation_failed(uint region_idx) const {
   return _regions_failed_evacuation.par_at(region_idx, memory_order_relaxed);
 }
@@ -26,6 +26,47 @@
 #include "gc/g1/g1CollectionSetCandidates.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
+#include "gc/g1/heapRegionRemSet.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/quickSort.hpp"
+
+// Order regions according to GC efficiency. This will cause regions with a lot
+// of live objects and large remembered sets to end up at the end of the array.
+// Given that we might skip collecting the last few old regions, if after a few
+// mixed GCs the remaining have reclaimable bytes under a certain threshold, the
+// hope is that the ones we'll skip are ones with both large remembered sets and
+// a lot of live objects, not the ones with just a lot of live objects if we
+// ordered according to the amount of reclaimable bytes per region.
+static int order_regions(HeapRegion* hr1, HeapRegion* hr2) {
+  double gc_eff1 = hr1->gc_efficiency();
+  double gc_eff2 = hr2->gc_efficiency();
+
+  if (gc_eff1 > gc_eff2) {
+    return -1;
+  } if (gc_eff1 < gc_eff2) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+uint G1CollectionSetCandidates::update_gc_efficiency(uint max_regions) {
+  assert(_front_idx == 0, "Must not have taken candidates yet");
+  // The order no longer matches the gc efficiencies.
+  _is_sorted = false;
+  uint end = MIN2(_num_regions, _num_efficiency_updated + max_regions);
+  for (uint i = _num_efficiency_updated; i < end; i++) {
+    _regions[i]->calc_gc_efficiency();
+  }
+  _num_efficiency_updated = end;
+  return _num_regions - _num_efficiency_updated;
+}
+
+void G1CollectionSetCandidates::sort_by_efficiency() {
+  assert(_front_idx == 0, "Must not have taken candidates yet");
+  QuickSort::sort(_regions, _num_regions, order_regions, true);
+  _is_sorted = true;
+}
 
 void G1CollectionSetCandidates::remove(uint num_regions) {
   assert(num_regions <= num_remaining(), "Trying to remove more regions (%u) than available (%u)", num_regions, num_remaining());
@@ -37,6 +78,7 @@ void G1CollectionSetCandidates::remove(uint num_regions) {
 
 void G1CollectionSetCandidates::remove_from_end(uint num_remove, size_t wasted) {
   assert(num_remove <= num_remaining(), "trying to remove more regions than remaining");
+  assert(_num_pruned_uncleared == 0, "must not remove regions twice");
 
 #ifdef ASSERT
   size_t reclaimable = 0;
@@ -44,16 +86,28 @@ void G1CollectionSetCandidates::remove_from_end(uint num_remove, size_t wasted)
   for (uint i = 0; i < num_remove; i++) {
     uint cur_idx = _num_regions - i - 1;
     reclaimable += at(cur_idx)->reclaimable_bytes();
-    // Make sure we crash if we access it.
-    _regions[cur_idx] = NULL;
   }
 
   assert(reclaimable == wasted, "Recalculated reclaimable inconsistent");
 #endif
+  // Keep the removed regions at the end of the array until their remembered
+  // sets have been cleared.
   _num_regions -= num_remove;
+  _num_pruned_uncleared = num_remove;
   _remaining_reclaimable_bytes -= wasted;
 }
 
+void G1CollectionSetCandidates::clear_pruned_rem_sets() {
+  // Concurrent refinement may add to the remembered sets at any other time.
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  for (uint i = _num_regions; i < _num_regions + _num_pruned_uncleared; i++) {
+    _regions[i]->rem_set()->clear(true /* cardset_only */);
+    // Make sure we crash if we access it.
+    DEBUG_ONLY(_regions[i] = NULL;)
+  }
+  _num_pruned_uncleared = 0;
+}
+
 void G1CollectionSetCandidates::iterate(HeapRegionClosure* cl) {
   for (uint i = _front_idx; i < _num_regions; i++) {
     HeapRegion* r = _regions[i];
@@ -89,7 +143,7 @@ void G1CollectionSetCandidates::verify() const {
     guarantee((cur->is_pinned() && !cur->is_archive()) ||
               G1CollectionSetChooser::should_add(cur),
               "Region %u should be eligible for addition.", cur->hrm_index());
-    if (prev != NULL) {
+    if (_is_sorted && prev != NULL) {
       guarantee(prev->gc_efficiency() >= cur->gc_efficiency(),
                 "GC efficiency for region %u: %1.4f smaller than for region %u: %1.4f",
                 prev->hrm_index(), prev->gc_efficiency(), cur->hrm_index(), cur->gc_efficiency());
@@ -34,8 +34,13 @@ class HeapRegion;
 class HeapRegionClosure;
 
 // Set of collection set candidates, i.e. all old gen regions we consider worth
-// collecting in the remainder of the current mixed phase. Regions are sorted by decreasing
-// gc efficiency.
+// collecting in the remainder of the current mixed phase. Once sorted, regions are
+// ordered by decreasing gc efficiency.
+// The Cleanup pause builds the candidates unsorted. The service thread then
+// refreshes the gc efficiency of the regions, sorts and prunes them (see
+// G1SortCollectionSetCandidatesTask). The next pause does that itself if the
+// service thread has not finished, and clears the remembered sets of the
+// pruned regions.
 // Maintains a cursor into the list that specifies the next collection set candidate
 // to put into the current collection set.
 class G1CollectionSetCandidates : public CHeapObj<mtGC> {
@@ -49,12 +54,25 @@ class G1CollectionSetCandidates : public CHeapObj<mtGC> {
   // addition to the current collection set.
   uint _front_idx;
 
+  // Number of regions from the start of the candidate array whose gc efficiency
+  // has been recalculated since the candidates were built.
+  uint _num_efficiency_updated;
+  bool _is_sorted;
+  bool _is_pruned;
+  // Number of pruned regions directly after the last candidate whose
+  // remembered sets still need to be cleared.
+  uint _num_pruned_uncleared;
+
 public:
   G1CollectionSetCandidates(HeapRegion** regions, uint num_regions, size_t remaining_reclaimable_bytes) :
     _regions(regions),
     _num_regions(num_regions),
     _remaining_reclaimable_bytes(remaining_reclaimable_bytes),
-    _front_idx(0) { }
+    _front_idx(0),
+    _num_efficiency_updated(0),
+    _is_sorted(false),
+    _is_pruned(false),
+    _num_pruned_uncleared(0) { }
 
   ~G1CollectionSetCandidates() {
     FREE_C_HEAP_ARRAY(HeapRegion*, _regions);
@@ -77,7 +95,10 @@ public:
   // Remove num_regions from the front of the collection set candidate list.
   void remove(uint num_regions);
   // Remove num_remove regions from the back of the collection set candidate list.
+  // Their remembered sets are cleared by clear_pruned_rem_sets().
   void remove_from_end(uint num_remove, size_t wasted);
+  // Clear the remembered sets of the regions removed by remove_from_end().
+  void clear_pruned_rem_sets();
 
   // Iterate over all remaining collection set candidate regions.
   void iterate(HeapRegionClosure* cl);
@@ -94,6 +115,17 @@ public:
   // candidate regions.
   size_t remaining_reclaimable_bytes() { return _remaining_reclaimable_bytes; }
 
+  // Recalculate the gc efficiency of at most max_regions regions not updated yet.
+  // The candidates are no longer sorted afterwards. Returns the number of regions
+  // whose gc efficiency still needs to be updated.
+  uint update_gc_efficiency(uint max_regions);
+  // Sort the candidates by decreasing gc efficiency.
+  void sort_by_efficiency();
+  bool is_sorted() const { return _is_sorted; }
+
+  bool is_pruned() const { return _is_pruned; }
+  void set_pruned() { _is_pruned = true; }
+
   void verify() const PRODUCT_RETURN;
 };
 
@@ -26,49 +26,19 @@
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1CollectionSetCandidates.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionRemSet.hpp"
 #include "gc/shared/space.inline.hpp"
 #include "runtime/atomic.hpp"
-#include "utilities/quickSort.hpp"
-
-// Order regions according to GC efficiency. This will cause regions with a lot
-// of live objects and large remembered sets to end up at the end of the array.
-// Given that we might skip collecting the last few old regions, if after a few
-// mixed GCs the remaining have reclaimable bytes under a certain threshold, the
-// hope is that the ones we'll skip are ones with both large remembered sets and
-// a lot of live objects, not the ones with just a lot of live objects if we
-// ordered according to the amount of reclaimable bytes per region.
-static int order_regions(HeapRegion* hr1, HeapRegion* hr2) {
-  // Make sure that NULL entries are moved to the end.
-  if (hr1 == NULL) {
-    if (hr2 == NULL) {
-      return 0;
-    } else {
-      return 1;
-    }
-  } else if (hr2 == NULL) {
-    return -1;
-  }
-
-  double gc_eff1 = hr1->gc_efficiency();
-  double gc_eff2 = hr2->gc_efficiency();
-
-  if (gc_eff1 > gc_eff2) {
-    return -1;
-  } if (gc_eff1 < gc_eff2) {
-    return 1;
-  } else {
-    return 0;
-  }
-}
 
 // Determine collection set candidates: For all regions determine whether they
-// should be a collection set candidates, calculate their efficiency, sort and
-// return them as G1CollectionSetCandidates instance.
+// should be a collection set candidates, calculate their efficiency and return
+// them as G1CollectionSetCandidates instance.
 // Threads calculate the GC efficiency of the regions they get to process, and
-// put them into some work area unsorted. At the end the array is sorted and
+// put them into some work area unsorted. At the end the array is compacted and
 // copied into the G1CollectionSetCandidates instance; the caller will be the new
-// owner of this object.
+// owner of this object. Sorting and pruning the candidates is deferred to the
+// service thread (see G1SortCollectionSetCandidatesTask).
 class G1BuildCandidateRegionsTask : public AbstractGangTask {
 
   // Work area for building the set of collection set candidates. Contains references
@@ -76,7 +46,7 @@ class G1BuildCandidateRegionsTask : public AbstractGangTask {
   // on claiming array elements, worker threads claim parts of this array in chunks;
   // Array elements may be NULL as threads might not get enough regions to fill
   // up their chunks completely.
-  // Final sorting will remove them.
+  // Copying the result will remove them.
   class G1BuildCandidateArray : public StackObj {
 
     uint const _max_size;
@@ -127,20 +97,18 @@ class G1BuildCandidateRegionsTask : public AbstractGangTask {
       _data[idx] = hr;
     }
 
-    void sort_and_copy_into(HeapRegion** dest, uint num_regions) {
-      if (_cur_claim_idx == 0) {
-        return;
-      }
+    void copy_into(HeapRegion** dest, uint num_regions) {
       for (uint i = _cur_claim_idx; i < _max_size; i++) {
         assert(_data[i] == NULL, "must be");
       }
-      QuickSort::sort(_data, _cur_claim_idx, order_regions, true);
-      for (uint i = num_regions; i < _max_size; i++) {
-        assert(_data[i] == NULL, "must be");
-      }
-      for (uint i = 0; i < num_regions; i++) {
-        dest[i] = _data[i];
+      uint num_copied = 0;
+      for (uint i = 0; i < _cur_claim_idx; i++) {
+        if (_data[i] != NULL) {
+          assert(num_copied < num_regions, "Too many regions in array");
+          dest[num_copied++] = _data[i];
+        }
       }
+      assert(num_copied == num_regions, "Copied %u regions but expected %u", num_copied, num_regions);
     }
   };
 
@@ -236,9 +204,9 @@ public:
     update_totals(cl.regions_added(), cl.reclaimable_bytes_added());
   }
 
-  G1CollectionSetCandidates* get_sorted_candidates() {
+  G1CollectionSetCandidates* get_candidates() {
     HeapRegion** regions = NEW_C_HEAP_ARRAY(HeapRegion*, _num_regions_added, mtGC);
-    _result.sort_and_copy_into(regions, _num_regions_added);
+    _result.copy_into(regions, _num_regions_added);
     return new G1CollectionSetCandidates(regions,
                                          _num_regions_added,
                                          _reclaimable_bytes_added);
@@ -253,6 +221,7 @@ uint G1CollectionSetChooser::calculate_work_chunk_size(uint num_workers, uint nu
 bool G1CollectionSetChooser::should_add(HeapRegion* hr) {
   return !hr->is_young() &&
          !hr->is_pinned() &&
+         !hr->has_pinned_objects() &&
          region_occupancy_low_enough_for_evac(hr->live_bytes()) &&
          hr->rem_set()->is_complete();
 }
@@ -260,7 +229,8 @@ bool G1CollectionSetChooser::should_add(HeapRegion* hr) {
 // Closure implementing early pruning (removal) of regions meeting the
 // G1HeapWastePercent criteria. That is, either until _max_pruned regions were
 // removed (for forward progress in evacuation) or the waste accumulated by the
-// removed regions is above max_wasted.
+// removed regions is above max_wasted. The remembered sets of the removed regions
+// are cleared later, in a pause.
 class G1PruneRegionClosure : public HeapRegionClosure {
   uint _num_pruned;
   size_t _cur_wasted;
@@ -278,7 +248,6 @@ public:
         _cur_wasted + reclaimable > _max_wasted) {
       return true;
     }
-    r->rem_set()->clear(true /* cardset_only */);
     _cur_wasted += reclaimable;
     _num_pruned++;
     return false;
@@ -318,8 +287,26 @@ G1CollectionSetCandidates* G1CollectionSetChooser::build(WorkGang* workers, uint
   G1BuildCandidateRegionsTask cl(max_num_regions, chunk_size, num_workers);
   workers->run_task(&cl, num_workers);
 
-  G1CollectionSetCandidates* result = cl.get_sorted_candidates();
-  prune(result);
+  G1CollectionSetCandidates* result = cl.get_candidates();
   result->verify();
   return result;
 }
+
+void G1CollectionSetChooser::sort_and_prune(G1CollectionSetCandidates* candidates) {
+  assert(!candidates->is_pruned(), "must not prune twice");
+  candidates->sort_by_efficiency();
+  prune(candidates);
+  candidates->set_pruned();
+}
+
+void G1CollectionSetChooser::finalize(G1CollectionSetCandidates* candidates) {
+  assert_at_safepoint_on_vm_thread();
+
+  if (!candidates->is_pruned()) {
+    log_debug(gc, ergo, cset)("Sorting %u collection set candidates before concurrent refresh completed",
+                              candidates->num_regions());
+    sort_and_prune(candidates);
+  }
+  candidates->clear_pruned_rem_sets();
+  candidates->verify();
+}
@@ -57,9 +57,15 @@ public:
   // Regions also need a complete remembered set to be a candidate.
   static bool should_add(HeapRegion* hr);
 
-  // Build and return set of collection set candidates sorted by decreasing gc
-  // efficiency.
+  // Build and return the unsorted set of collection set candidates.
   static G1CollectionSetCandidates* build(WorkGang* workers, uint max_num_regions);
+
+  // Sort the given candidates by decreasing gc efficiency and prune them.
+  static void sort_and_prune(G1CollectionSetCandidates* candidates);
+
+  // Prepare the given candidates for use in a pause: sort and prune them unless
+  // that happened before, and clear the remembered sets of pruned regions.
+  static void finalize(G1CollectionSetCandidates* candidates);
 };
 
 #endif // SHARE_GC_G1_G1COLLECTIONSETCHOOSER_HPP
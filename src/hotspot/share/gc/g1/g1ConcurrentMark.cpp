@@ -1163,12 +1163,6 @@ void G1ConcurrentMark::remark() {
       reclaim_empty_regions();
     }
 
-    // Clean out dead classes
-    if (ClassUnloadingWithConcurrentMark) {
-      GCTraceTime(Debug, gc, phases) debug("Purge Metaspace", _gc_timer_cm);
-      ClassLoaderDataGraph::purge(/*at_safepoint*/true);
-    }
-
     _g1h->resize_heap_if_necessary();
     _g1h->uncommit_regions_if_necessary();
 
@@ -1302,7 +1296,11 @@ void G1ConcurrentMark::reclaim_empty_regions() {
 }
 
 void G1ConcurrentMark::compute_new_sizes() {
-  MetaspaceGC::compute_new_size();
+  // With class unloading, metaspace is resized after the concurrent purge
+  // freed the metadata of the unloaded classes.
+  if (!ClassUnloadingWithConcurrentMark) {
+    MetaspaceGC::compute_new_size();
+  }
 
   // Cleanup will have freed any regions completely full of garbage.
   // Update the soft reference policy with the new heap occupancy.
@@ -1647,6 +1645,14 @@ class G1CMSATBBufferClosure : public SATBBufferClosure {
 private:
   G1CMTask* _task;
   G1CollectedHeap* _g1h;
+  G1CMBitMap* const _bitmap;
+
+  // Marking an entry updates its mark bit and, if it is pushed, reads its
+  // klass.
+  void prefetch_entry(void* entry) const {
+    _bitmap->prefetch((HeapWord*)entry);
+    Prefetch::read(entry, 0);
+  }
 
   // This is very similar to G1CMTask::deal_with_reference, but with
   // more relaxed requirements for the argument, so this must be more
@@ -1659,10 +1665,13 @@ private:
 
 public:
   G1CMSATBBufferClosure(G1CMTask* task, G1CollectedHeap* g1h)
-    : _task(task), _g1h(g1h) { }
+    : _task(task), _g1h(g1h), _bitmap(g1h->concurrent_mark()->next_mark_bitmap()) { }
 
   virtual void do_buffer(void** buffer, size_t size) {
     for (size_t i = 0; i < size; ++i) {
+      if (i + PrefetchDistance < size) {
+        prefetch_entry(buffer[i + PrefetchDistance]);
+      }
       do_entry(buffer[i]);
     }
   }
@@ -1903,6 +1912,30 @@ void G1ConcurrentMark::rebuild_rem_set_concurrently() {
   _g1h->rem_set()->rebuild_rem_set(this, _concurrent_workers, _worker_id_offset);
 }
 
+void G1ConcurrentMark::purge_metaspace_concurrently() {
+  // Remark unlinked the dead class loaders and all nmethods referencing them,
+  // so nobody can reach their metadata any more. Only deleting the CLDs and
+  // returning the metaspace remains, which does not need to be done in the
+  // pause.
+  if (!ClassUnloadingWithConcurrentMark) {
+    return;
+  }
+  // Only take the list while joined to the STS, so that a Full GC can not
+  // purge it at the same time. The deletion itself may take long and must
+  // not hold off safepoints.
+  ClassLoaderData* unloading;
+  {
+    SuspendibleThreadSetJoiner sts;
+    unloading = ClassLoaderDataGraph::take_unloading_list();
+  }
+  ClassLoaderDataGraph::purge(unloading, /*at_safepoint*/false);
+
+  // Resize metaspace now that the dead metadata has been freed. Remark
+  // skipped that. Join the STS again to not race with a Full GC resizing it.
+  SuspendibleThreadSetJoiner sts;
+  MetaspaceGC::compute_new_size();
+}
+
 void G1ConcurrentMark::print_stats() {
   if (!log_is_enabled(Debug, gc, stats)) {
     return;
@@ -2947,7 +2980,7 @@ G1PrintRegionLivenessInfoClosure::~G1PrintRegionLivenessInfoClosure() {
   }
 
   // add static memory usages to remembered set sizes
-  _total_remset_bytes += HeapRegionRemSet::fl_mem_size() + HeapRegionRemSet::static_mem_size();
+  _total_remset_bytes += HeapRegionRemSet::static_mem_size();
   // Print the footer of the output.
   log_trace(gc, liveness)(G1PPRL_LINE_PREFIX);
   log_trace(gc, liveness)(G1PPRL_LINE_PREFIX
@@ -599,6 +599,10 @@ private:
   // Rebuilds the remembered sets for chosen regions in parallel and concurrently to the application.
   void rebuild_rem_set_concurrently();
 
+  // Frees the class loader data and metaspace of the classes unloaded during
+  // Remark, and resizes metaspace afterwards.
+  void purge_metaspace_concurrently();
+
   uint needs_remembered_set_rebuild() const { return _needs_remembered_set_rebuild; }
 
 };
@@ -205,9 +205,10 @@ inline size_t deactivation_level(const Thresholds& t) { return t.second; }
 
 static Thresholds calc_thresholds(size_t green_zone,
                                   size_t yellow_zone,
+                                  uint num_threads,
                                   uint worker_id) {
   double yellow_size = yellow_zone - green_zone;
-  double step = yellow_size / G1ConcurrentRefine::max_num_threads();
+  double step = yellow_size / MAX2(num_threads, 1u);
   if (worker_id == 0) {
     // Potentially activate worker 0 more aggressively, to keep
     // available buffers near green_zone value.  When yellow_size is
@@ -231,7 +232,8 @@ G1ConcurrentRefine::G1ConcurrentRefine(size_t green_zone,
   _green_zone(green_zone),
   _yellow_zone(yellow_zone),
   _red_zone(red_zone),
-  _min_yellow_zone_size(min_yellow_zone_size)
+  _min_yellow_zone_size(min_yellow_zone_size),
+  _num_threads_wanted(max_num_threads())
 {
   assert_zone_constraints_gyr(green_zone, yellow_zone, red_zone);
 }
@@ -340,6 +342,29 @@ static size_t calc_new_green_zone(size_t green,
   return green;
 }
 
+// Green zone based on the number of cards the next pause is predicted to be
+// able to process within the goal time.
+static size_t calc_predicted_green_zone(double goal_ms, double predicted_card_cost_ms) {
+  assert(predicted_card_cost_ms > 0.0, "must be");
+  double cards = goal_ms / predicted_card_cost_ms;
+  return MIN2(static_cast<size_t>(cards), max_green_zone);
+}
+
+// Number of refinement threads needed to refine cards at the rate they are
+// dirtied by the mutator.
+static uint calc_num_threads_wanted(double dirtied_cards_rate_ms, double refine_rate_ms) {
+  uint max_threads = G1ConcurrentRefine::max_num_threads();
+  if (refine_rate_ms <= 0.0) {
+    return max_threads;
+  }
+  double wanted = ceil(dirtied_cards_rate_ms / refine_rate_ms);
+  if (wanted >= max_threads) {
+    return max_threads;
+  }
+  // Always keep at least one thread to process cards above the green zone.
+  return MAX2(static_cast<uint>(wanted), 1u);
+}
+
 static size_t calc_new_yellow_zone(size_t green, size_t min_yellow_size) {
   size_t size = green * 2;
   size = MAX2(size, min_yellow_size);
@@ -352,37 +377,63 @@ static size_t calc_new_red_zone(size_t green, size_t yellow) {
 
 void G1ConcurrentRefine::update_zones(double logged_cards_scan_time,
                                       size_t processed_logged_cards,
-                                      double goal_ms) {
+                                      double goal_ms,
+                                      double predicted_card_cost_ms,
+                                      double predicted_dirtied_cards_rate_ms,
+                                      double predicted_refine_rate_ms) {
   log_trace( CTRL_TAGS )("Updating Refinement Zones: "
                          "logged cards scan time: %.3fms, "
                          "processed cards: " SIZE_FORMAT ", "
-                         "goal time: %.3fms",
+                         "goal time: %.3fms, "
+                         "predicted card cost: %.6fms, "
+                         "predicted dirtied cards rate: %.2f cards/ms, "
+                         "predicted refine rate: %.2f cards/ms",
                          logged_cards_scan_time,
                          processed_logged_cards,
-                         goal_ms);
+                         goal_ms,
+                         predicted_card_cost_ms,
+                         predicted_dirtied_cards_rate_ms,
+                         predicted_refine_rate_ms);
 
-  _green_zone = calc_new_green_zone(_green_zone,
-                                    logged_cards_scan_time,
-                                    processed_logged_cards,
-                                    goal_ms);
+  if (predicted_card_cost_ms > 0.0) {
+    _green_zone = calc_predicted_green_zone(goal_ms, predicted_card_cost_ms);
+  } else {
+    // Not enough samples for a prediction yet; adjust based on the last
+    // pause only.
+    _green_zone = calc_new_green_zone(_green_zone,
+                                      logged_cards_scan_time,
+                                      processed_logged_cards,
+                                      goal_ms);
+  }
   _yellow_zone = calc_new_yellow_zone(_green_zone, _min_yellow_zone_size);
   _red_zone = calc_new_red_zone(_green_zone, _yellow_zone);
+  _num_threads_wanted = calc_num_threads_wanted(predicted_dirtied_cards_rate_ms,
+                                                predicted_refine_rate_ms);
 
   assert_zone_constraints_gyr(_green_zone, _yellow_zone, _red_zone);
   LOG_ZONES("Updated Refinement Zones: "
             "green: " SIZE_FORMAT ", "
             "yellow: " SIZE_FORMAT ", "
-            "red: " SIZE_FORMAT,
-            _green_zone, _yellow_zone, _red_zone);
+            "red: " SIZE_FORMAT ", "
+            "threads wanted: %u",
+            _green_zone, _yellow_zone, _red_zone, _num_threads_wanted);
 }
 
 void G1ConcurrentRefine::adjust(double logged_cards_scan_time,
                                 size_t processed_logged_cards,
-                                double goal_ms) {
+                                double goal_ms,
+                                double predicted_card_cost_ms,
+                                double predicted_dirtied_cards_rate_ms,
+                                double predicted_refine_rate_ms) {
   G1DirtyCardQueueSet& dcqs = G1BarrierSet::dirty_card_queue_set();
 
   if (G1UseAdaptiveConcRefinement) {
-    update_zones(logged_cards_scan_time, processed_logged_cards, goal_ms);
+    update_zones(logged_cards_scan_time,
+                 processed_logged_cards,
+                 goal_ms,
+                 predicted_card_cost_ms,
+                 predicted_dirtied_cards_rate_ms,
+                 predicted_refine_rate_ms);
 
     // Change the barrier params
     if (max_num_threads() == 0) {
@@ -422,12 +473,12 @@ G1ConcurrentRefineStats G1ConcurrentRefine::get_and_reset_refinement_stats() {
 }
 
 size_t G1ConcurrentRefine::activation_threshold(uint worker_id) const {
-  Thresholds thresholds = calc_thresholds(_green_zone, _yellow_zone, worker_id);
+  Thresholds thresholds = calc_thresholds(_green_zone, _yellow_zone, _num_threads_wanted, worker_id);
   return activation_level(thresholds);
 }
 
 size_t G1ConcurrentRefine::deactivation_threshold(uint worker_id) const {
-  Thresholds thresholds = calc_thresholds(_green_zone, _yellow_zone, worker_id);
+  Thresholds thresholds = calc_thresholds(_green_zone, _yellow_zone, _num_threads_wanted, worker_id);
   return deactivation_level(thresholds);
 }
 
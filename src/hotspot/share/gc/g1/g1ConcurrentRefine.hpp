@@ -69,6 +69,11 @@ public:
 // Refinement thread n activates thread n+1 if the instance of this class determines there
 // is enough work available. Threads deactivate themselves if the current amount of
 // available cards falls below their individual threshold.
+// With G1UseAdaptiveConcRefinement the thresholds are derived from predictions
+// after every pause: the green zone is the number of cards the next pause is
+// predicted to be able to process within its time goal, and the yellow zone is
+// spread over the number of threads needed to keep up with the predicted rate
+// of dirtied cards.
 class G1ConcurrentRefine : public CHeapObj<mtGC> {
   G1ConcurrentRefineThreadControl _thread_control;
   /*
@@ -92,16 +97,22 @@ class G1ConcurrentRefine : public CHeapObj<mtGC> {
   size_t _yellow_zone;
   size_t _red_zone;
   size_t _min_yellow_zone_size;
+  // Number of refinement threads the yellow zone is spread over.
+  uint _num_threads_wanted;
 
   G1ConcurrentRefine(size_t green_zone,
                      size_t yellow_zone,
                      size_t red_zone,
                      size_t min_yellow_zone_size);
 
-  // Update green/yellow/red zone values based on how well goals are being met.
+  // Update green/yellow/red zone values based on how well goals are being met
+  // and the given predictions.
   void update_zones(double logged_cards_scan_time,
                     size_t processed_logged_cards,
-                    double goal_ms);
+                    double goal_ms,
+                    double predicted_card_cost_ms,
+                    double predicted_dirtied_cards_rate_ms,
+                    double predicted_refine_rate_ms);
 
   static uint worker_id_offset();
   void maybe_activate_more_threads(uint worker_id, size_t num_cur_cards);
@@ -116,8 +127,17 @@ public:
 
   void stop();
 
-  // Adjust refinement thresholds based on work done during the pause and the goal time.
-  void adjust(double logged_cards_scan_time, size_t processed_logged_cards, double goal_ms);
+  // Adjust refinement thresholds based on work done during the pause, the goal
+  // time, the predicted cost of processing a pending card during the pause, and
+  // the predicted rates of dirtying cards by the mutator and refining cards by a
+  // single refinement thread (in cards per ms). A predicted card cost of 0.0
+  // means that no prediction is available yet.
+  void adjust(double logged_cards_scan_time,
+              size_t processed_logged_cards,
+              double goal_ms,
+              double predicted_card_cost_ms,
+              double predicted_dirtied_cards_rate_ms,
+              double predicted_refine_rate_ms);
 
   // Return total of concurrent refinement stats for the
   // ConcurrentRefineThreads.  Also reset the stats for the threads.
@@ -142,6 +162,7 @@ public:
   size_t green_zone() const      { return _green_zone;  }
   size_t yellow_zone() const     { return _yellow_zone; }
   size_t red_zone() const        { return _red_zone;    }
+  uint num_threads_wanted() const { return _num_threads_wanted; }
 };
 
 #endif // SHARE_GC_G1_G1CONCURRENTREFINE_HPP
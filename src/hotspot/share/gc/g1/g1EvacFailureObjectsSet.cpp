@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1EvacFailureObjectsSet.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "memory/iterator.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/quickSort.hpp"
+
+G1EvacFailureObjectsSet::G1EvacFailureObjectsSet(uint region_idx, HeapWord* bottom) :
+  DEBUG_ONLY(_region_idx(region_idx) COMMA)
+  _bottom(bottom),
+  _chunks(NULL),
+  _num_objects(0) {
+  assert(HeapRegion::LogOfHRGrainBytes < 32, "must be");
+}
+
+G1EvacFailureObjectsSet::~G1EvacFailureObjectsSet() {
+  clear();
+}
+
+oop G1EvacFailureObjectsSet::from_offset(OffsetInRegion offset) const {
+  return cast_to_oop(_bottom + offset);
+}
+
+G1EvacFailureObjectsSet::OffsetInRegion G1EvacFailureObjectsSet::to_offset(oop obj) const {
+  assert(obj != NULL, "must be");
+  assert(G1CollectedHeap::heap()->heap_region_containing(obj)->hrm_index() == _region_idx,
+         "wrong region");
+  return (OffsetInRegion)pointer_delta(cast_from_oop<HeapWord*>(obj), _bottom);
+}
+
+void G1EvacFailureObjectsSet::record(oop obj) {
+  OffsetInRegion offset = to_offset(obj);
+  Atomic::inc(&_num_objects, memory_order_relaxed);
+
+  while (true) {
+    Chunk* cur = Atomic::load_acquire(&_chunks);
+    if (cur != NULL) {
+      uint idx = Atomic::fetch_and_add(&cur->_num_claimed, 1u);
+      if (idx < ChunkLength) {
+        cur->_offsets[idx] = offset;
+        return;
+      }
+    }
+    // The current chunk is full (or there is none yet); try to install a new
+    // chunk containing the offset.
+    Chunk* new_chunk = new Chunk(cur);
+    new_chunk->_offsets[0] = offset;
+    new_chunk->_num_claimed = 1;
+    if (Atomic::cmpxchg(&_chunks, cur, new_chunk) == cur) {
+      return;
+    }
+    delete new_chunk;
+  }
+}
+
+uint G1EvacFailureObjectsSet::num_objects() const {
+  return Atomic::load(&_num_objects);
+}
+
+void G1EvacFailureObjectsSet::clear() {
+  Chunk* cur = _chunks;
+  while (cur != NULL) {
+    Chunk* next = cur->_next;
+    delete cur;
+    cur = next;
+  }
+  _chunks = NULL;
+  _num_objects = 0;
+}
+
+static int order_oop(G1EvacFailureObjectsSet::OffsetInRegion a,
+                     G1EvacFailureObjectsSet::OffsetInRegion b) {
+  return static_cast<int>(a) - static_cast<int>(b);
+}
+
+void G1EvacFailureObjectsSet::process_and_drop(ObjectClosure* closure) {
+  uint num = num_objects();
+  if (num == 0) {
+    return;
+  }
+
+  OffsetInRegion* offsets = NEW_C_HEAP_ARRAY(OffsetInRegion, num, mtGC);
+  uint cur_idx = 0;
+  for (Chunk* cur = _chunks; cur != NULL; cur = cur->_next) {
+    uint length = cur->length();
+    memcpy(offsets + cur_idx, cur->_offsets, length * sizeof(OffsetInRegion));
+    cur_idx += length;
+  }
+  assert(cur_idx == num, "must be %u %u", cur_idx, num);
+
+  QuickSort::sort(offsets, num, order_oop, true);
+
+  for (uint i = 0; i < num; i++) {
+    assert(i == 0 || offsets[i - 1] < offsets[i], "must be sorted and unique");
+    closure->do_object(from_offset(offsets[i]));
+  }
+
+  FREE_C_HEAP_ARRAY(OffsetInRegion, offsets);
+  clear();
+}
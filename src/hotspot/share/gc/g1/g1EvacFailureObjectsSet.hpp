@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+#ifndef SHARE_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
+#define SHARE_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class ObjectClosure;
+
+// This class collects addresses of objects that failed evacuation in a specific
+// heap region.
+// Provides sorted iteration of these elements for processing during the remove
+// self forwards phase.
+class G1EvacFailureObjectsSet {
+public:
+  // Storage type of an object that failed evacuation within a region. Given
+  // heap region size and possible object locations within a region, it is
+  // sufficient to use an uint here to save some space instead of full pointers.
+  typedef uint OffsetInRegion;
+
+private:
+  static const uint ChunkLength = 256;
+
+  // A fixed size chunk of offsets. The chunks form a singly linked list,
+  // the most recently allocated chunk first.
+  struct Chunk : public CHeapObj<mtGC> {
+    Chunk* _next;
+    // Number of claimed slots in _offsets; may exceed ChunkLength.
+    volatile uint _num_claimed;
+    OffsetInRegion _offsets[ChunkLength];
+
+    Chunk(Chunk* next) : _next(next), _num_claimed(0) { }
+
+    uint length() const { return MIN2(_num_claimed, ChunkLength); }
+  };
+
+  DEBUG_ONLY(uint _region_idx;)
+  HeapWord* _bottom;
+
+  Chunk* volatile _chunks;
+  volatile uint _num_objects;
+
+  oop from_offset(OffsetInRegion offset) const;
+  OffsetInRegion to_offset(oop obj) const;
+
+  // Free all chunks.
+  void clear();
+
+public:
+  G1EvacFailureObjectsSet(uint region_idx, HeapWord* bottom);
+  ~G1EvacFailureObjectsSet();
+
+  // Record an object that failed evacuation. May be called concurrently by
+  // multiple threads.
+  void record(oop obj);
+
+  uint num_objects() const;
+
+  // Apply the given ObjectClosure to all objects that failed evacuation, in
+  // increasing address order. Objects are cleared after processing. Must not be
+  // called concurrently with record().
+  void process_and_drop(ObjectClosure* closure);
+};
+
+#endif // SHARE_GC_G1_G1EVACFAILUREOBJECTSSET_HPP
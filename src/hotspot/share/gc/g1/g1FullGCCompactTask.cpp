@@ -89,13 +89,22 @@ void G1FullGCCompactTask::compact_region(HeapRegion* hr) {
   hr->reset_compacted_after_full_gc();
 }
 
+void G1FullGCCompactTask::compact_queue(G1FullGCCompactionPoint* cp) {
+  uint index;
+  while (cp->claim_region(index)) {
+    cp->wait_for_destinations(index);
+    compact_region(cp->regions()->at(index));
+    cp->set_compacted(index);
+  }
+}
+
 void G1FullGCCompactTask::work(uint worker_id) {
   Ticks start = Ticks::now();
-  GrowableArray<HeapRegion*>* compaction_queue = collector()->compaction_point(worker_id)->regions();
-  for (GrowableArrayIterator<HeapRegion*> it = compaction_queue->begin();
-       it != compaction_queue->end();
-       ++it) {
-    compact_region(*it);
+  // Start with the compaction queue prepared by this worker, then help
+  // with the remaining regions of the other queues.
+  uint num_queues = collector()->workers();
+  for (uint i = 0; i < num_queues; i++) {
+    compact_queue(collector()->compaction_point((worker_id + i) % num_queues));
   }
 
   G1ResetSkipCompactingClosure hc(collector());
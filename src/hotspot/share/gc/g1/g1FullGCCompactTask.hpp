@@ -40,6 +40,8 @@ protected:
 
 private:
   void compact_region(HeapRegion* hr);
+  // Compact the regions of the given compaction queue claimed by this worker.
+  void compact_queue(G1FullGCCompactionPoint* cp);
 
 public:
   G1FullGCCompactTask(G1FullCollector* collector) :
@@ -26,18 +26,24 @@
 #include "gc/g1/g1FullGCCompactionPoint.hpp"
 #include "gc/g1/heapRegion.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "utilities/debug.hpp"
+#include "utilities/spinYield.hpp"
 
 G1FullGCCompactionPoint::G1FullGCCompactionPoint() :
     _current_region(NULL),
+    _current_region_index(0),
     _threshold(NULL),
-    _compaction_top(NULL) {
+    _compaction_top(NULL),
+    _claim_index(0) {
   _compaction_regions = new (ResourceObj::C_HEAP, mtGC) GrowableArray<HeapRegion*>(32, mtGC);
   _compaction_region_iterator = _compaction_regions->begin();
+  _region_infos = new (ResourceObj::C_HEAP, mtGC) GrowableArray<RegionInfo>(32, mtGC);
 }
 
 G1FullGCCompactionPoint::~G1FullGCCompactionPoint() {
   delete _compaction_regions;
+  delete _region_infos;
 }
 
 void G1FullGCCompactionPoint::update() {
@@ -73,6 +79,7 @@ HeapRegion* G1FullGCCompactionPoint::current_region() {
 HeapRegion* G1FullGCCompactionPoint::next_region() {
   HeapRegion* next = *(++_compaction_region_iterator);
   assert(next != NULL, "Must return valid region");
+  _current_region_index++;
   return next;
 }
 
@@ -134,8 +141,44 @@ void G1FullGCCompactionPoint::forward(oop object, size_t size) {
 
 void G1FullGCCompactionPoint::add(HeapRegion* hr) {
   _compaction_regions->append(hr);
+  _region_infos->append(RegionInfo());
 }
 
 HeapRegion* G1FullGCCompactionPoint::remove_last() {
+  _region_infos->pop();
   return _compaction_regions->pop();
 }
+
+void G1FullGCCompactionPoint::set_destinations_of_last(uint first, uint last) {
+  assert(first <= last, "invalid destination range %u-%u", first, last);
+  assert(last < (uint)_region_infos->length(), "destination %u out of bounds", last);
+  RegionInfo* info = _region_infos->adr_at(_region_infos->length() - 1);
+  info->_first_destination = first;
+  info->_last_destination = last;
+}
+
+bool G1FullGCCompactionPoint::claim_region(uint& index) {
+  uint num_regions = (uint)_compaction_regions->length();
+  if (Atomic::load(&_claim_index) >= num_regions) {
+    return false;
+  }
+  index = Atomic::fetch_and_add(&_claim_index, 1u);
+  return index < num_regions;
+}
+
+void G1FullGCCompactionPoint::wait_for_destinations(uint index) {
+  const RegionInfo* info = _region_infos->adr_at(index);
+  // Regions are claimed in queue order and only depend on regions earlier in
+  // the queue, so the wait always terminates.
+  for (uint i = info->_first_destination; i <= info->_last_destination && i < index; i++) {
+    bool* compacted = &_region_infos->adr_at(i)->_compacted;
+    SpinYield spin;
+    while (!Atomic::load_acquire(compacted)) {
+      spin.wait();
+    }
+  }
+}
+
+void G1FullGCCompactionPoint::set_compacted(uint index) {
+  Atomic::release_store(&_region_infos->adr_at(index)->_compacted, true);
+}
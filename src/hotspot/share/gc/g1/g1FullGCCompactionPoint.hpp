@@ -32,11 +32,29 @@
 class HeapRegion;
 
 class G1FullGCCompactionPoint : public CHeapObj<mtGC> {
+  // Per region information of the compaction queue used to compact the regions
+  // of a single queue in parallel. Live objects of a region are only ever moved
+  // into regions at the same or an earlier position in the queue, the range of
+  // these positions is recorded during preparation. A region may be compacted
+  // as soon as all regions in that range, other than itself, have been
+  // compacted.
+  struct RegionInfo {
+    uint _first_destination;
+    uint _last_destination;
+    bool _compacted;
+
+    RegionInfo() : _first_destination(0), _last_destination(0), _compacted(false) { }
+  };
+
   HeapRegion* _current_region;
+  uint        _current_region_index;
   HeapWord*   _threshold;
   HeapWord*   _compaction_top;
   GrowableArray<HeapRegion*>* _compaction_regions;
   GrowableArrayIterator<HeapRegion*> _compaction_region_iterator;
+  GrowableArray<RegionInfo>* _region_infos;
+  // Index of the next region in the queue to be claimed for compaction.
+  volatile uint _claim_index;
 
   bool object_will_fit(size_t size);
   void initialize_values(bool init_threshold);
@@ -56,6 +74,19 @@ public:
 
   HeapRegion* remove_last();
   HeapRegion* current_region();
+  uint current_region_index() const { return _current_region_index; }
+
+  // Record the range of queue positions the live objects of the last added
+  // region have been forwarded to.
+  void set_destinations_of_last(uint first, uint last);
+
+  // Claim the next region of the queue for compaction. Regions are claimed
+  // in queue order by any worker.
+  bool claim_region(uint& index);
+  // Wait until all regions the claimed region at index compacts into are
+  // available, i.e. have been compacted themselves.
+  void wait_for_destinations(uint index);
+  void set_compacted(uint index);
 
   GrowableArray<HeapRegion*>* regions();
 };
@@ -74,10 +74,10 @@ bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(HeapRegion*
     } else if (hr->is_closed_archive()) {
       // nothing to do with closed archive region
     } else {
-      assert(MarkSweepDeadRatio > 0,
+      assert(MarkSweepDeadRatio > 0 || hr->has_pinned_objects(),
              "only skip compaction for other regions when MarkSweepDeadRatio > 0");
 
-      // Too many live objects; skip compacting it.
+      // Too many live objects or pinned objects; skip compacting it.
       _collector->update_from_compacting_to_skip_compacting(hr->hrm_index());
       if (hr->is_young()) {
         // G1 updates the BOT for old region contents incrementally, but young regions
@@ -137,7 +137,7 @@ G1FullGCPrepareTask::G1CalculatePointersClosure::G1CalculatePointersClosure(G1Fu
     _regions_freed(false) { }
 
 bool G1FullGCPrepareTask::G1CalculatePointersClosure::should_compact(HeapRegion* hr) {
-  if (hr->is_pinned()) {
+  if (hr->is_pinned() || hr->has_pinned_objects()) {
     return false;
   }
   size_t live_words = _collector->live_words(hr->hrm_index());
@@ -194,7 +194,9 @@ void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_compaction(Hea
   }
   // Add region to the compaction queue and prepare it.
   _cp->add(hr);
+  uint first_destination = _cp->current_region_index();
   prepare_for_compaction_work(_cp, hr);
+  _cp->set_destinations_of_last(first_destination, _cp->current_region_index());
 }
 
 void G1FullGCPrepareTask::prepare_serial_compaction() {
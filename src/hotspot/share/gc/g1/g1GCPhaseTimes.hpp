@@ -98,9 +98,9 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   }
 
   enum GCMergeRSWorkTimes {
-    MergeRSMergedSparse,
-    MergeRSMergedFine,
-    MergeRSMergedCoarse,
+    MergeRSMergedArray,
+    MergeRSMergedBitMap,
+    MergeRSMergedFull,
     MergeRSDirtyCards
   };
 
@@ -131,7 +131,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
   enum GCEagerlyReclaimHumongousObjectsItems {
     EagerlyReclaimNumTotal,
     EagerlyReclaimNumCandidates,
-    EagerlyReclaimNumReclaimed
+    EagerlyReclaimNumReclaimed,
+    EagerlyReclaimNumObjArraysReclaimed
   };
 
  private:
@@ -234,6 +235,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   double get_time_secs(GCParPhases phase, uint worker_id);
 
+  uint max_gc_threads() const { return _max_gc_threads; }
+
   void record_thread_work_item(GCParPhases phase, uint worker_id, size_t count, uint index = 0);
 
   void record_or_add_thread_work_item(GCParPhases phase, uint worker_id, size_t count, uint index = 0);
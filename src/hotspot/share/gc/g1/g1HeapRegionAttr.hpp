@@ -40,10 +40,14 @@ public:
   typedef int8_t region_type_t;
 #endif
   typedef uint8_t needs_remset_update_t;
+  typedef uint8_t is_pinned_t;
 
 private:
   needs_remset_update_t _needs_remset_update;
   region_type_t _type;
+  // Whether the region contains objects pinned by JNI critical sections. Such
+  // regions are retained in place instead of being evacuated.
+  is_pinned_t _is_pinned;
 
 public:
   // Selection of the values for the _type field were driven to micro-optimize the
@@ -62,8 +66,8 @@ public:
   static const region_type_t Old          =   1;    // The region is in the collection set and an old region.
   static const region_type_t Num          =   2;
 
-  G1HeapRegionAttr(region_type_t type = NotInCSet, bool needs_remset_update = false) :
-    _needs_remset_update(needs_remset_update), _type(type) {
+  G1HeapRegionAttr(region_type_t type = NotInCSet, bool needs_remset_update = false, bool is_pinned = false) :
+    _needs_remset_update(needs_remset_update), _type(type), _is_pinned(is_pinned) {
 
     assert(is_valid(), "Invalid type %d", _type);
   }
@@ -82,6 +86,7 @@ public:
   }
 
   bool needs_remset_update() const     { return _needs_remset_update != 0; }
+  bool is_pinned() const               { return _is_pinned != 0; }
 
   void set_old()                       { _type = Old; }
   void clear_humongous()               {
@@ -89,6 +94,7 @@ public:
     _type = NotInCSet;
   }
   void set_has_remset(bool value)      { _needs_remset_update = value ? 1 : 0; }
+  void set_is_pinned(bool value)       { _is_pinned = value ? 1 : 0; }
 
   bool is_in_cset_or_humongous() const { return is_in_cset() || is_humongous(); }
   bool is_in_cset() const              { return type() >= Young; }
@@ -140,16 +146,20 @@ class G1HeapRegionAttrBiasedMappedArray : public G1BiasedMappedArray<G1HeapRegio
     get_ref_by_index(index)->set_has_remset(needs_remset_update);
   }
 
+  void set_is_pinned(uintptr_t index, bool is_pinned) {
+    get_ref_by_index(index)->set_is_pinned(is_pinned);
+  }
+
   void set_in_young(uintptr_t index) {
     assert(get_by_index(index).is_default(),
            "Region attributes at index " INTPTR_FORMAT " should be default but is %s", index, get_by_index(index).get_type_str());
     set_by_index(index, G1HeapRegionAttr(G1HeapRegionAttr::Young, true));
   }
 
-  void set_in_old(uintptr_t index, bool needs_remset_update) {
+  void set_in_old(uintptr_t index, bool needs_remset_update, bool is_pinned) {
     assert(get_by_index(index).is_default(),
            "Region attributes at index " INTPTR_FORMAT " should be default but is %s", index, get_by_index(index).get_type_str());
-    set_by_index(index, G1HeapRegionAttr(G1HeapRegionAttr::Old, needs_remset_update));
+    set_by_index(index, G1HeapRegionAttr(G1HeapRegionAttr::Old, needs_remset_update, is_pinned));
   }
 
   bool is_in_cset_or_humongous(HeapWord* addr) const { return at(addr).is_in_cset_or_humongous(); }
@@ -402,7 +402,7 @@ HeapWord* G1ParScanThreadState::allocate_copy_slow(G1HeapRegionAttr* dest_attr,
     }
   }
   if (obj_ptr != NULL) {
-    update_numa_stats(node_index);
+    update_numa_stats(*dest_attr, node_index);
     if (_g1h->_gc_tracer_stw->should_report_promotion_events()) {
       // The events are checked individually as part of the actual commit
       report_promotion_event(*dest_attr, old, word_sz, age, obj_ptr, node_index);
@@ -428,6 +428,12 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   assert(region_attr.is_in_cset(),
          "Unexpected region attr type: %s", region_attr.get_type_str());
 
+  if (region_attr.is_pinned()) {
+    // Objects in regions with pinned objects must not move; keep them in
+    // place like objects that failed evacuation.
+    return handle_evacuation_failure_par(old, old_mark, true /* is_pinned */);
+  }
+
   // Get the klass once.  We'll need it again later, and this avoids
   // re-decoding when it's compressed.
   Klass* klass = old->klass();
@@ -447,7 +453,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
     if (obj_ptr == NULL) {
       // This will either forward-to-self, or detect that someone else has
       // installed a forwarding pointer.
-      return handle_evacuation_failure_par(old, old_mark);
+      return handle_evacuation_failure_par(old, old_mark, false /* is_pinned */);
     }
   }
 
@@ -460,7 +466,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
     // Doing this after all the allocation attempts also tests the
     // undo_allocation() method too.
     undo_allocation(dest_attr, obj_ptr, word_sz, node_index);
-    return handle_evacuation_failure_par(old, old_mark);
+    return handle_evacuation_failure_par(old, old_mark, false /* is_pinned */);
   }
 #endif // !PRODUCT
 
@@ -597,7 +603,7 @@ void G1ParScanThreadStateSet::record_unused_optional_region(HeapRegion* hr) {
 }
 
 NOINLINE
-oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m) {
+oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m, bool is_pinned) {
   assert(_g1h->is_in_cset(old), "Object " PTR_FORMAT " should be in the CSet", p2i(old));
 
   oop forward_ptr = old->forward_to_atomic(old, m, memory_order_relaxed);
@@ -605,11 +611,20 @@ oop G1ParScanThreadState::handle_evacuation_failure_par(oop old, markWord m) {
     // Forward-to-self succeeded. We are the "owner" of the object.
     HeapRegion* r = _g1h->heap_region_containing(old);
 
-    if (_g1h->notify_region_failed_evacuation(r->hrm_index())) {
+    if (_g1h->notify_region_failed_evacuation(r->hrm_index()) && !is_pinned) {
       _g1h->hr_printer()->evac_failure(r);
     }
 
-    _g1h->preserve_mark_during_evac_failure(_worker_id, old, m);
+    // Mark the failing object in the region's set of failed objects.
+    r->record_evac_failure_obj(old);
+
+    if (is_pinned) {
+      // Retaining pinned objects is not an evacuation failure to report.
+      _g1h->preserve_mark_of_pinned_object(_worker_id, old, m);
+    } else {
+      _g1h->notify_evacuation_alloc_failed();
+      _g1h->preserve_mark_during_evac_failure(_worker_id, old, m);
+    }
 
     G1ScanInYoungSetter x(&_scanner, r->is_young());
     old->oop_iterate_backwards(&_scanner);
@@ -634,8 +649,8 @@ void G1ParScanThreadState::initialize_numa_stats() {
     if (lt.is_enabled()) {
       uint num_nodes = _numa->num_active_nodes();
       // Record only if there are multiple active nodes.
-      _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
-      memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes);
+      _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes * G1HeapRegionAttr::Num, mtGC);
+      memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes * G1HeapRegionAttr::Num);
     }
   }
 }
@@ -643,13 +658,17 @@ void G1ParScanThreadState::initialize_numa_stats() {
 void G1ParScanThreadState::flush_numa_stats() {
   if (_obj_alloc_stat != NULL) {
     uint node_index = _numa->index_of_current_thread();
-    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
+    uint num_nodes = _numa->num_active_nodes();
+    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index,
+                           _obj_alloc_stat + G1HeapRegionAttr::Young * num_nodes);
+    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToOld, node_index,
+                           _obj_alloc_stat + G1HeapRegionAttr::Old * num_nodes);
   }
 }
 
-void G1ParScanThreadState::update_numa_stats(uint node_index) {
+void G1ParScanThreadState::update_numa_stats(G1HeapRegionAttr dest_attr, uint node_index) {
   if (_obj_alloc_stat != NULL) {
-    _obj_alloc_stat[node_index]++;
+    _obj_alloc_stat[dest_attr.type() * _numa->num_active_nodes() + node_index]++;
   }
 }
 
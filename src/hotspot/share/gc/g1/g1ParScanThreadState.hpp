@@ -101,7 +101,8 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
 
   G1NUMA* _numa;
 
-  // Records how many object allocations happened at each node during copy to survivor.
+  // Records how many object allocations happened at each node during copy to
+  // survivor and old regions, indexed by destination type and node.
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
   size_t* _obj_alloc_stat;
@@ -209,7 +210,7 @@ private:
   // NUMA statistics related methods.
   void initialize_numa_stats();
   void flush_numa_stats();
-  inline void update_numa_stats(uint node_index);
+  inline void update_numa_stats(G1HeapRegionAttr dest_attr, uint node_index);
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
@@ -221,8 +222,9 @@ public:
   Tickspan trim_ticks() const;
   void reset_trim_ticks();
 
-  // An attempt to evacuate "obj" has failed; take necessary steps.
-  oop handle_evacuation_failure_par(oop obj, markWord m);
+  // An attempt to evacuate "obj" has failed, or "obj" is in a region with
+  // pinned objects (is_pinned); take necessary steps.
+  oop handle_evacuation_failure_par(oop obj, markWord m, bool is_pinned);
 
   template <typename T>
   inline void remember_root_into_optional_region(T* p);
@@ -37,6 +37,7 @@
 #include "gc/g1/g1IHOPControl.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1Policy.hpp"
+#include "gc/g1/g1SortCollectionSetCandidatesTask.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
@@ -530,6 +531,13 @@ void G1Policy::record_collection_pause_start(double start_time_sec) {
 
   record_concurrent_refinement_stats();
 
+  // The concurrent refresh of the collection set candidates may be in
+  // progress. Make sure they are sorted and pruned before this pause may use
+  // them.
+  if (_collection_set->candidates() != NULL) {
+    G1CollectionSetChooser::finalize(_collection_set->candidates());
+  }
+
   _collection_set->reset_bytes_used_before();
 
   // do that for any other surv rate groups
@@ -611,6 +619,19 @@ bool G1Policy::concurrent_operation_is_full_mark(const char* msg) {
     ((_g1h->gc_cause() != GCCause::_g1_humongous_allocation) || need_to_start_conc_mark(msg));
 }
 
+double G1Policy::predict_pending_card_cost_ms() const {
+  if (!_analytics->enough_young_card_cost_samples_available()) {
+    return 0.0;
+  }
+  // Pending cards are merged into the card table and then possibly scanned
+  // during the next (most likely young) collection.
+  const size_t num_cards = 1000;
+  double merge_time = _analytics->predict_card_merge_time_ms(num_cards, true);
+  size_t scan_cards = (size_t)(num_cards * _analytics->predict_young_card_merge_to_scan_ratio());
+  double scan_time = _analytics->predict_card_scan_time_ms(scan_cards, true);
+  return (merge_time + scan_time) / num_cards;
+}
+
 double G1Policy::logged_cards_processing_time() const {
   double all_cards_processing_time = average_time_ms(G1GCPhaseTimes::ScanHR) + average_time_ms(G1GCPhaseTimes::OptScanHR);
   size_t logged_dirty_cards = phase_times()->sum_thread_work_items(G1GCPhaseTimes::MergeLB, G1GCPhaseTimes::MergeLBDirtyCards);
@@ -829,7 +850,10 @@ void G1Policy::record_collection_pause_end(double pause_time_ms, bool concurrent
 
   _g1h->concurrent_refine()->adjust(logged_cards_time,
                                     phase_times()->sum_thread_work_items(G1GCPhaseTimes::MergeLB, G1GCPhaseTimes::MergeLBDirtyCards),
-                                    scan_logged_cards_time_goal_ms);
+                                    scan_logged_cards_time_goal_ms,
+                                    predict_pending_card_cost_ms(),
+                                    _analytics->predict_dirtied_cards_rate_ms(),
+                                    _analytics->predict_concurrent_refine_rate_ms());
 }
 
 G1IHOPControl* G1Policy::create_ihop_control(const G1OldGenAllocationTracker* old_gen_alloc_tracker,
@@ -1107,6 +1131,10 @@ void G1Policy::record_concurrent_mark_cleanup_end(bool has_rebuilt_remembered_se
     G1CollectionSetCandidates* candidates = G1CollectionSetChooser::build(_g1h->workers(), _g1h->num_regions());
     _collection_set->set_candidates(candidates);
     mixed_gc_pending = next_gc_should_be_mixed("request mixed gcs", "request young-only gcs");
+    if (mixed_gc_pending) {
+      // Sort and prune the candidates outside of the pause.
+      G1SortCollectionSetCandidatesTask::enqueue();
+    }
   }
 
   if (log_is_enabled(Trace, gc, liveness)) {
@@ -1143,10 +1171,11 @@ void G1Policy::clear_collection_set_candidates() {
   if (_collection_set->candidates() == NULL) {
     return;
   }
-  // Clear remembered sets of remaining candidate regions and the actual candidate
-  // set.
+  // Clear remembered sets of remaining and pruned candidate regions and the
+  // actual candidate set.
   G1ClearCollectionSetCandidateRemSets cl;
   _collection_set->candidates()->iterate(&cl);
+  _collection_set->candidates()->clear_pruned_rem_sets();
   _collection_set->clear_candidates();
 }
 
@@ -1161,8 +1190,9 @@ void G1Policy::maybe_start_marking() {
 
 bool G1Policy::should_update_gc_stats() {
   // Evacuation failures skew the timing too much to be considered for statistics updates.
-  // We make the assumption that these are rare.
-  return !_g1h->evacuation_failed();
+  // We make the assumption that these are rare. Regions retained because of
+  // pinned objects do not count as failures.
+  return !_g1h->evacuation_alloc_failed();
 }
 
 void G1Policy::update_gc_pause_time_ratios(G1GCPauseType gc_type, double start_time_sec, double end_time_sec) {
@@ -1242,8 +1272,21 @@ bool G1Policy::next_gc_should_be_mixed(const char* true_action_str,
     log_debug(gc, ergo)("%s (candidate old regions not available)", false_action_str);
     return false;
   }
+  if (!candidates->is_pruned()) {
+    // Pruning needs sorted candidates. Without that, only start mixed gcs if
+    // the candidates can reclaim more than the waste we are willing to accept.
+    size_t reclaimable_bytes = candidates->remaining_reclaimable_bytes();
+    double reclaimable_percent = reclaimable_bytes_percent(reclaimable_bytes);
+    if (reclaimable_percent <= (double) G1HeapWastePercent) {
+      log_debug(gc, ergo)("%s (reclaimable percentage not over threshold). "
+                          "candidate old regions: %u reclaimable: " SIZE_FORMAT " (%1.2f) threshold: " UINTX_FORMAT,
+                          false_action_str, candidates->num_remaining(), reclaimable_bytes, reclaimable_percent,
+                          G1HeapWastePercent);
+      return false;
+    }
+  }
   // Go through all regions - we already pruned regions not worth collecting
-  // during candidate selection.
+  // during candidate selection, or will do so before the first mixed gc.
   return true;
 }
 
@@ -116,6 +116,9 @@ class G1Policy: public CHeapObj<mtGC> {
   }
 
   double logged_cards_processing_time() const;
+  // Predicted time to process a single pending card during a collection, or
+  // 0.0 if there are not enough samples for a prediction yet.
+  double predict_pending_card_cost_ms() const;
 public:
   const G1Predictions& predictor() const { return _predictor; }
   const G1Analytics* analytics()   const { return const_cast<const G1Analytics*>(_analytics); }
@@ -158,6 +158,18 @@ class G1RegionsSmallerThanCommitSizeMapper : public G1RegionToSpaceMapper {
     }
   }
 
+  // Commit the pages [start_page, end_page) with a single call to the underlying
+  // storage. Returns whether the committed memory is known to be zero filled.
+  bool commit_pages(size_t start_page, size_t end_page) {
+    assert(start_page < end_page, "Must commit at least one page");
+    bool zero_filled = _storage.commit(start_page, end_page - start_page);
+    // Move memory to correct NUMA node for the heap.
+    for (size_t page = start_page; page < end_page; page++) {
+      numa_request_on_node(page);
+    }
+    return zero_filled;
+  }
+
  public:
   G1RegionsSmallerThanCommitSizeMapper(ReservedSpace rs,
                                        size_t actual_size,
@@ -181,7 +193,7 @@ class G1RegionsSmallerThanCommitSizeMapper : public G1RegionToSpaceMapper {
     size_t const NoPage = ~(size_t)0;
 
     size_t first_committed = NoPage;
-    size_t num_committed = 0;
+    size_t last_committed = NoPage;
 
     size_t start_page = region_idx_to_page_idx(start_idx);
     size_t end_page = region_idx_to_page_idx(region_limit - 1);
@@ -192,24 +204,31 @@ class G1RegionsSmallerThanCommitSizeMapper : public G1RegionToSpaceMapper {
     // underlying OS page. See lock declaration for more details.
     {
       MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
-      for (size_t page = start_page; page <= end_page; page++) {
-        if (!is_page_committed(page)) {
+      // Start of the current run of contiguous uncommitted pages. Such runs are
+      // committed together to minimize the number of calls into the OS.
+      size_t run_start = NoPage;
+      for (size_t page = start_page; page <= end_page + 1; page++) {
+        if (page <= end_page && !is_page_committed(page)) {
           // Page not committed.
-          if (num_committed == 0) {
-            first_committed = page;
+          if (run_start == NoPage) {
+            run_start = page;
           }
-          num_committed++;
-
-          if (!_storage.commit(page, 1)) {
+          continue;
+        }
+        if (page <= end_page) {
+          // Page already committed.
+          all_zero_filled = false;
+        }
+        if (run_start != NoPage) {
+          if (!commit_pages(run_start, page)) {
             // Found dirty region during commit.
             all_zero_filled = false;
           }
-
-          // Move memory to correct NUMA node for the heap.
-          numa_request_on_node(page);
-        } else {
-          // Page already committed.
-          all_zero_filled = false;
+          if (first_committed == NoPage) {
+            first_committed = run_start;
+          }
+          last_committed = page - 1;
+          run_start = NoPage;
         }
       }
 
@@ -218,8 +237,10 @@ class G1RegionsSmallerThanCommitSizeMapper : public G1RegionToSpaceMapper {
       _region_commit_map.set_range(start_idx, region_limit, BitMap::unknown_range);
     }
 
-    if (AlwaysPreTouch && num_committed > 0) {
-      _storage.pretouch(first_committed, num_committed, pretouch_gang);
+    if (AlwaysPreTouch && first_committed != NoPage) {
+      // Pages between the committed runs were already committed before, so
+      // touching them again is harmless.
+      _storage.pretouch(first_committed, last_committed - first_committed + 1, pretouch_gang);
     }
 
     fire_on_commit(start_idx, num_regions, all_zero_filled);
@@ -241,12 +262,21 @@ class G1RegionsSmallerThanCommitSizeMapper : public G1RegionToSpaceMapper {
     // updates to _region_commit_map for this mapper is protected by _lock.
     _region_commit_map.clear_range(start_idx, region_limit, BitMap::unknown_range);
 
-    for (size_t page = start_page; page <= end_page; page++) {
+    // Coalesce contiguous pages to uncommit to minimize the number of calls
+    // into the OS.
+    size_t const NoPage = ~(size_t)0;
+    size_t run_start = NoPage;
+    for (size_t page = start_page; page <= end_page + 1; page++) {
       // We know all pages were committed before clearing the map. If the
       // the page is still marked as committed after the clear we should
       // not uncommit it.
-      if (!is_page_committed(page)) {
-        _storage.uncommit(page, 1);
+      if (page <= end_page && !is_page_committed(page)) {
+        if (run_start == NoPage) {
+          run_start = page;
+        }
+      } else if (run_start != NoPage) {
+        _storage.uncommit(run_start, page - run_start);
+        run_start = NoPage;
       }
     }
   }
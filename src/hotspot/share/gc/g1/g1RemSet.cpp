@@ -45,7 +45,6 @@
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionManager.inline.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
-#include "gc/g1/sparsePRT.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/ptrQueue.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
@@ -1121,9 +1120,9 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
     G1RemSetScanState* _scan_state;
     G1CardTable* _ct;
 
-    uint _merged_sparse;
-    uint _merged_fine;
-    uint _merged_coarse;
+    uint _merged_array;
+    uint _merged_bitmap;
+    uint _merged_full;
 
     size_t _cards_dirty;
 
@@ -1173,9 +1172,9 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
     G1MergeCardSetClosure(G1RemSetScanState* scan_state) :
       _scan_state(scan_state),
       _ct(G1CollectedHeap::heap()->card_table()),
-      _merged_sparse(0),
-      _merged_fine(0),
-      _merged_coarse(0),
+      _merged_array(0),
+      _merged_bitmap(0),
+      _merged_full(0),
       _cards_dirty(0),
       _region_base_idx(0),
       _merge_card_set_cache(this) {
@@ -1188,24 +1187,24 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
       mark_card(to_process);
     }
 
-    void next_coarse_prt(uint const region_idx) {
+    void next_full_container(uint const region_idx) {
       if (!remember_if_interesting(region_idx)) {
         return;
       }
 
-      _merged_coarse++;
+      _merged_full++;
 
       start_iterate(region_idx);
       _cards_dirty += _ct->mark_region_dirty(_region_base_idx, HeapRegion::CardsPerRegion);
       _scan_state->set_chunk_region_dirty(_region_base_idx);
     }
 
-    void next_fine_prt(uint const region_idx, BitMap* bm) {
+    void next_bitmap_container(uint const region_idx, BitMap* bm) {
       if (!remember_if_interesting(region_idx)) {
         return;
       }
 
-      _merged_fine++;
+      _merged_bitmap++;
 
       start_iterate(region_idx);
       BitMap::idx_t cur = bm->get_next_one_offset(0);
@@ -1215,12 +1214,12 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
       }
     }
 
-    void next_sparse_prt(uint const region_idx, SparsePRTEntry::card_elem_t* cards, uint const num_cards) {
+    void next_array_container(uint const region_idx, G1CardSet::card_elem_t* cards, uint const num_cards) {
       if (!remember_if_interesting(region_idx)) {
         return;
       }
 
-      _merged_sparse++;
+      _merged_array++;
 
       start_iterate(region_idx);
       for (uint i = 0; i < num_cards; i++) {
@@ -1247,7 +1246,7 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
 
       HeapRegionRemSet* rem_set = r->rem_set();
       if (!rem_set->is_empty()) {
-        rem_set->iterate_prts(*this);
+        rem_set->iterate_for_merge(*this);
       }
     }
 
@@ -1260,9 +1259,9 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
       return false;
     }
 
-    size_t merged_sparse() const { return _merged_sparse; }
-    size_t merged_fine() const { return _merged_fine; }
-    size_t merged_coarse() const { return _merged_coarse; }
+    size_t merged_array() const { return _merged_array; }
+    size_t merged_bitmap() const { return _merged_bitmap; }
+    size_t merged_full() const { return _merged_full; }
 
     size_t cards_dirty() const { return _cards_dirty; }
   };
@@ -1307,9 +1306,9 @@ class G1MergeHeapRootsTask : public AbstractGangTask {
       return false;
     }
 
-    size_t merged_sparse() const { return _cl.merged_sparse(); }
-    size_t merged_fine() const { return _cl.merged_fine(); }
-    size_t merged_coarse() const { return _cl.merged_coarse(); }
+    size_t merged_array() const { return _cl.merged_array(); }
+    size_t merged_bitmap() const { return _cl.merged_bitmap(); }
+    size_t merged_full() const { return _cl.merged_full(); }
 
     size_t cards_dirty() const { return _cl.cards_dirty(); }
   };
@@ -1442,9 +1441,9 @@ public:
       G1FlushHumongousCandidateRemSets cl(_scan_state);
       g1h->heap_region_iterate(&cl);
 
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_sparse(), G1GCPhaseTimes::MergeRSMergedSparse);
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_fine(), G1GCPhaseTimes::MergeRSMergedFine);
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_coarse(), G1GCPhaseTimes::MergeRSMergedCoarse);
+      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_array(), G1GCPhaseTimes::MergeRSMergedArray);
+      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_bitmap(), G1GCPhaseTimes::MergeRSMergedBitMap);
+      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_full(), G1GCPhaseTimes::MergeRSMergedFull);
       p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.cards_dirty(), G1GCPhaseTimes::MergeRSDirtyCards);
     }
 
@@ -1454,9 +1453,9 @@ public:
       G1MergeCardSetClosure cl(_scan_state);
       g1h->collection_set_iterate_increment_from(&cl, &_hr_claimer, worker_id);
 
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_sparse(), G1GCPhaseTimes::MergeRSMergedSparse);
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_fine(), G1GCPhaseTimes::MergeRSMergedFine);
-      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_coarse(), G1GCPhaseTimes::MergeRSMergedCoarse);
+      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_array(), G1GCPhaseTimes::MergeRSMergedArray);
+      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_bitmap(), G1GCPhaseTimes::MergeRSMergedBitMap);
+      p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.merged_full(), G1GCPhaseTimes::MergeRSMergedFull);
       p->record_or_add_thread_work_item(merge_remset_phase, worker_id, cl.cards_dirty(), G1GCPhaseTimes::MergeRSDirtyCards);
     }
 
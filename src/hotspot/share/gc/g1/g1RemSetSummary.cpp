@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1BarrierSet.hpp"
+#include "gc/g1/g1CardSet.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/g1ConcurrentRefineThread.hpp"
@@ -210,11 +211,16 @@ private:
   size_t max_code_root_mem_sz() const       { return _max_code_root_mem_sz; }
   HeapRegion* max_code_root_mem_sz_region() const { return _max_code_root_mem_sz_region; }
 
+  size_t _num_array_containers;
+  size_t _num_bitmap_containers;
+  size_t _num_full_containers;
+
 public:
   HRRSStatsIter() : _young("Young"), _humongous("Humongous"),
     _free("Free"), _old("Old"), _archive("Archive"), _all("All"),
     _max_rs_mem_sz(0), _max_rs_mem_sz_region(NULL),
-    _max_code_root_mem_sz(0), _max_code_root_mem_sz_region(NULL)
+    _max_code_root_mem_sz(0), _max_code_root_mem_sz_region(NULL),
+    _num_array_containers(0), _num_bitmap_containers(0), _num_full_containers(0)
   {}
 
   bool do_heap_region(HeapRegion* r) {
@@ -235,6 +241,11 @@ public:
     }
     size_t code_root_elems = hrrs->strong_code_roots_list_length();
 
+    const G1CardSet* card_set = hrrs->card_set();
+    _num_array_containers += card_set->num_array_containers();
+    _num_bitmap_containers += card_set->num_bitmap_containers();
+    _num_full_containers += card_set->num_full_containers();
+
     RegionTypeCounter* current = NULL;
     if (r->is_free()) {
       current = &_free;
@@ -269,12 +280,13 @@ public:
       (*current)->print_rs_mem_info_on(out, total_rs_mem_sz());
     }
 
-    out->print_cr("   Static structures = " SIZE_FORMAT "%s,"
-                  " free_lists = " SIZE_FORMAT "%s.",
+    out->print_cr("   Static structures = " SIZE_FORMAT "%s.",
                   byte_size_in_proper_unit(HeapRegionRemSet::static_mem_size()),
-                  proper_unit_for_byte_size(HeapRegionRemSet::static_mem_size()),
-                  byte_size_in_proper_unit(HeapRegionRemSet::fl_mem_size()),
-                  proper_unit_for_byte_size(HeapRegionRemSet::fl_mem_size()));
+                  proper_unit_for_byte_size(HeapRegionRemSet::static_mem_size()));
+
+    out->print_cr("    " SIZE_FORMAT " containers: " SIZE_FORMAT " array, " SIZE_FORMAT " bitmap, " SIZE_FORMAT " full.",
+                  _num_array_containers + _num_bitmap_containers + _num_full_containers,
+                  _num_array_containers, _num_bitmap_containers, _num_full_containers);
 
     out->print_cr("    " SIZE_FORMAT " occupied cards represented.",
                   total_cards_occupied());
@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_G1_G1ROOTPROCESSOR_HPP
 #define SHARE_GC_G1_G1ROOTPROCESSOR_HPP
 
+#include "classfile/classLoaderDataGraph.hpp"
 #include "gc/shared/oopStorageSetParState.hpp"
 #include "gc/shared/strongRootsScope.hpp"
 #include "memory/allocation.hpp"
@@ -51,9 +52,9 @@ class G1RootProcessor : public StackObj {
   SubTasksDone _process_strong_tasks;
   StrongRootsScope _srs;
   OopStorageSetStrongParState<false, false> _oop_storage_set_strong_par_state;
+  ClassLoaderDataGraphParRootsIterator _cld_roots_iter;
 
   enum G1H_process_roots_tasks {
-    G1RP_PS_ClassLoaderDataGraph_oops_do,
     G1RP_PS_CodeCache_oops_do,
     G1RP_PS_refProcessor_oops_do,
     // Leave this one last.
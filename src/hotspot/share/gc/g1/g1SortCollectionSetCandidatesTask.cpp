@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1CollectionSet.hpp"
+#include "gc/g1/g1CollectionSetCandidates.hpp"
+#include "gc/g1/g1CollectionSetChooser.hpp"
+#include "gc/g1/g1SortCollectionSetCandidatesTask.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "utilities/ticks.hpp"
+
+G1SortCollectionSetCandidatesTask* G1SortCollectionSetCandidatesTask::_instance = NULL;
+
+G1SortCollectionSetCandidatesTask::G1SortCollectionSetCandidatesTask() :
+    G1ServiceTask("G1 Sort Collection Set Candidates Task"),
+    _active(false) { }
+
+void G1SortCollectionSetCandidatesTask::initialize() {
+  assert(_instance == NULL, "Already initialized");
+  _instance = new G1SortCollectionSetCandidatesTask();
+
+  // Register the task with the service thread. This will automatically
+  // schedule the task so we change the state to active.
+  _instance->set_active(true);
+  G1CollectedHeap::heap()->service_thread()->register_task(_instance);
+}
+
+void G1SortCollectionSetCandidatesTask::enqueue() {
+  assert_at_safepoint_on_vm_thread();
+
+  if (_instance == NULL) {
+    initialize();
+  } else if (!_instance->is_active()) {
+    _instance->set_active(true);
+    G1CollectedHeap::heap()->service_thread()->schedule_task(_instance, 0);
+  }
+}
+
+bool G1SortCollectionSetCandidatesTask::is_active() {
+  return _active;
+}
+
+void G1SortCollectionSetCandidatesTask::set_active(bool state) {
+  assert(_active != state, "Must do a state change");
+  // There is no need to guard _active with a lock since the places where it
+  // is updated can never run in parallel. The state is set to true only in
+  // a safepoint and it is set to false while running on the service thread
+  // joined with the suspendible thread set.
+  _active = state;
+}
+
+void G1SortCollectionSetCandidatesTask::execute() {
+  assert(_active, "Must be active");
+
+  // Prevent from running during a GC pause. Apart from this task, the
+  // candidates may only be replaced, sorted, pruned or taken in a pause, so
+  // after joining they are stable until the end of this step.
+  SuspendibleThreadSetJoiner sts;
+  G1CollectionSetCandidates* candidates = G1CollectedHeap::heap()->collection_set()->candidates();
+
+  if (candidates == NULL || candidates->is_pruned()) {
+    // The candidates have been dropped, or a pause needed them before this
+    // task completed.
+    set_active(false);
+    return;
+  }
+
+  Ticks start = Ticks::now();
+  if (candidates->update_gc_efficiency(RegionsPerStep) > 0) {
+    schedule(TaskDelayMs);
+    return;
+  }
+
+  G1CollectionSetChooser::sort_and_prune(candidates);
+  log_debug(gc, ergo, cset)("Concurrently sorted and pruned collection set candidates, %u remaining, last step %1.3fms",
+                            candidates->num_regions(), (Ticks::now() - start).seconds() * 1000.0);
+  set_active(false);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1SORTCOLLECTIONSETCANDIDATESTASK_HPP
+#define SHARE_GC_G1_G1SORTCOLLECTIONSETCANDIDATESTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Task recalculating the gc efficiency of the collection set candidates built
+// in the Cleanup pause using current remembered set sizes, and then sorting and
+// pruning them. This keeps that work out of the Cleanup pause, and makes the
+// order of the candidates reflect remembered set growth since remark.
+// If a pause needs the candidates before this task completes, the pause sorts
+// and prunes them itself, and the task stops.
+class G1SortCollectionSetCandidatesTask : public G1ServiceTask {
+  // Maximum number of regions the gc efficiency is recalculated for during a
+  // single execution of the task. This limits the time for a step to well
+  // below a millisecond.
+  static const uint RegionsPerStep = 1024;
+  // The delay between two task executions.
+  static const uint TaskDelayMs = 1;
+
+  static G1SortCollectionSetCandidatesTask* _instance;
+  static void initialize();
+
+  // The _active state is used to prevent the task from being enqueued on the
+  // service thread multiple times.
+  bool _active;
+
+  G1SortCollectionSetCandidatesTask();
+  bool is_active();
+  void set_active(bool state);
+
+public:
+  static void enqueue();
+  virtual void execute();
+};
+
+#endif // SHARE_GC_G1_G1SORTCOLLECTIONSETCANDIDATESTASK_HPP
@@ -24,10 +24,12 @@
 
 #include "precompiled.hpp"
 #include "gc/g1/g1EvacuationInfo.hpp"
+#include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1HeapRegionTraceType.hpp"
 #include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1GCPauseType.hpp"
 #include "gc/shared/gcHeapSummary.hpp"
+#include "gc/shared/workerDataArray.inline.hpp"
 #include "jfr/jfrEvents.hpp"
 #if INCLUDE_JFR
 #include "jfr/metadata/jfrSerializer.hpp"
@@ -97,6 +99,28 @@ void G1NewTracer::report_evacuation_statistics(const G1EvacSummary& young_summar
   send_old_evacuation_statistics(old_summary);
 }
 
+void G1NewTracer::report_phase_worker_times(G1GCPhaseTimes* phase_times) const {
+  // Avoid iterating over all phases and workers if nobody listens.
+  if (!EventG1GCPhaseWorkerTime::is_enabled()) {
+    return;
+  }
+  static const G1GCPhaseTimes::GCParPhases phases[] = {
+    G1GCPhaseTimes::ExtRootScan,
+    G1GCPhaseTimes::MergeRS,
+    G1GCPhaseTimes::ScanHR,
+    G1GCPhaseTimes::ObjCopy,
+    G1GCPhaseTimes::Termination
+  };
+  for (uint i = 0; i < ARRAY_SIZE(phases); i++) {
+    for (uint worker_id = 0; worker_id < phase_times->max_gc_threads(); worker_id++) {
+      double time_secs = phase_times->get_time_secs(phases[i], worker_id);
+      if (time_secs != WorkerDataArray<double>::uninitialized()) {
+        send_phase_worker_time_event(G1GCPhaseTimes::phase_name(phases[i]), worker_id, time_secs);
+      }
+    }
+  }
+}
+
 void G1NewTracer::report_basic_ihop_statistics(size_t threshold,
                                                size_t target_ccupancy,
                                                size_t current_occupancy,
@@ -205,6 +229,17 @@ void G1NewTracer::send_old_evacuation_statistics(const G1EvacSummary& summary) c
   }
 }
 
+void G1NewTracer::send_phase_worker_time_event(const char* name, uint worker_id, double time_secs) const {
+  EventG1GCPhaseWorkerTime e;
+  if (e.should_commit()) {
+    e.set_gcId(GCId::current());
+    e.set_name(name);
+    e.set_gcWorkerId(worker_id);
+    e.set_duration((jlong)(time_secs * NANOSECS_PER_SEC));
+    e.commit();
+  }
+}
+
 void G1NewTracer::send_basic_ihop_statistics(size_t threshold,
                                              size_t target_occupancy,
                                              size_t current_occupancy,
@@ -29,6 +29,7 @@
 #include "gc/shared/gcTrace.hpp"
 
 class G1EvacuationInfo;
+class G1GCPhaseTimes;
 class G1HeapSummary;
 class G1EvacSummary;
 
@@ -50,6 +51,10 @@ public:
 
   void report_evacuation_statistics(const G1EvacSummary& young_summary, const G1EvacSummary& old_summary) const;
 
+  // Report the time every worker spent in the main parallel phases of the
+  // current pause.
+  void report_phase_worker_times(G1GCPhaseTimes* phase_times) const;
+
   void report_basic_ihop_statistics(size_t threshold,
                                     size_t target_occupancy,
                                     size_t current_occupancy,
@@ -71,6 +76,8 @@ private:
   void send_young_evacuation_statistics(const G1EvacSummary& summary) const;
   void send_old_evacuation_statistics(const G1EvacSummary& summary) const;
 
+  void send_phase_worker_time_event(const char* name, uint worker_id, double time_secs) const;
+
   void send_basic_ihop_statistics(size_t threshold,
                                   size_t target_occupancy,
                                   size_t current_occupancy,
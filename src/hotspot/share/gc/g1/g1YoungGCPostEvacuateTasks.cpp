@@ -89,6 +89,7 @@ void G1PostEvacuateCollectionSetCleanupTask1::RemoveSelfForwardPtrsTask::do_work
 
 class G1FreeHumongousRegionClosure : public HeapRegionClosure {
   uint _humongous_objects_reclaimed;
+  uint _humongous_objarrays_reclaimed;
   uint _humongous_regions_reclaimed;
   size_t _freed_bytes;
 
@@ -119,10 +120,9 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
   // So there is no need to re-check remembered set size of the humongous region.
   //
   // Other implementation considerations:
-  // - never consider object arrays at this time because they would pose
-  // considerable effort for cleaning up the the remembered sets. This is
-  // required because stale remembered sets might reference locations that
-  // are currently allocated into.
+  // - object arrays are only candidates if there is no concurrent marking or
+  // remembered set rebuild in progress. The remembered set entries they
+  // induced on other regions are left stale (see G1PrepareRegionsClosure).
   bool is_reclaimable(uint region_idx) const {
     return G1CollectedHeap::heap()->is_humongous_reclaim_candidate(region_idx);
   }
@@ -130,6 +130,7 @@ class G1FreeHumongousRegionClosure : public HeapRegionClosure {
 public:
   G1FreeHumongousRegionClosure() :
     _humongous_objects_reclaimed(0),
+    _humongous_objarrays_reclaimed(0),
     _humongous_regions_reclaimed(0),
     _freed_bytes(0) {
   }
@@ -145,8 +146,8 @@ public:
     }
 
     oop obj = cast_to_oop(r->bottom());
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
+    guarantee(obj->is_typeArray() || obj->is_objArray(),
+              "Only eagerly reclaiming arrays is supported, but the object "
               PTR_FORMAT " is not.", p2i(r->bottom()));
 
     log_debug(gc, humongous)("Reclaimed humongous region %u (object size " SIZE_FORMAT " @ " PTR_FORMAT ")",
@@ -164,6 +165,9 @@ public:
            BOOL_TO_STR(cm->is_marked_in_prev_bitmap(obj)),
            BOOL_TO_STR(cm->is_marked_in_next_bitmap(obj)));
     _humongous_objects_reclaimed++;
+    if (obj->is_objArray()) {
+      _humongous_objarrays_reclaimed++;
+    }
     do {
       HeapRegion* next = g1h->next_region_in_humongous(r);
       _freed_bytes += r->used();
@@ -181,6 +185,10 @@ public:
     return _humongous_objects_reclaimed;
   }
 
+  uint humongous_objarrays_reclaimed() {
+    return _humongous_objarrays_reclaimed;
+  }
+
   uint humongous_regions_reclaimed() {
     return _humongous_regions_reclaimed;
   }
@@ -222,6 +230,7 @@ void G1PostEvacuateCollectionSetCleanupTask2::EagerlyReclaimHumongousObjectsTask
   record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumTotal, g1h->num_humongous_objects());
   record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumCandidates, g1h->num_humongous_reclaim_candidates());
   record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumReclaimed, cl.humongous_objects_reclaimed());
+  record_work_item(worker_id, G1GCPhaseTimes::EagerlyReclaimNumObjArraysReclaimed, cl.humongous_objarrays_reclaimed());
 
   _humongous_regions_reclaimed = cl.humongous_regions_reclaimed();
   _bytes_freed = cl.bytes_freed();
@@ -154,26 +154,32 @@
           range(0, max_jubyte)                                              \
                                                                             \
   develop(intx, G1RSetRegionEntriesBase, 256,                               \
-          "Max number of regions in a fine-grain table per MB.")            \
+          "Max number of bitmap containers in a remembered set per MB.")    \
           range(1, max_jint/wordSize)                                       \
                                                                             \
   product(intx, G1RSetRegionEntries, 0,                                     \
-          "Max number of regions for which we keep bitmaps."                \
-          "Will be set ergonomically by default")                           \
+          "Max number of regions for which a remembered set keeps "         \
+          "bitmaps. Will be set ergonomically by default")                  \
           range(0, max_jint/wordSize)                                       \
           constraint(G1RSetRegionEntriesConstraintFunc,AfterErgo)           \
                                                                             \
   develop(intx, G1RSetSparseRegionEntriesBase, 4,                           \
-          "Max number of entries per region in a sparse table "             \
+          "Max number of cards per region in an array container "           \
           "per MB.")                                                        \
           range(1, max_jint/wordSize)                                       \
                                                                             \
   product(intx, G1RSetSparseRegionEntries, 0,                               \
-          "Max number of entries per region in a sparse table."             \
-          "Will be set ergonomically by default.")                          \
+          "Max number of cards per region in an array container of a "      \
+          "remembered set. Will be set ergonomically by default.")          \
           range(0, max_jint/wordSize)                                       \
           constraint(G1RSetSparseRegionEntriesConstraintFunc,AfterErgo)     \
                                                                             \
+  product(uint, G1RemSetCoarsenBitMapToFullPercent, 90, EXPERIMENTAL,       \
+          "Percentage of cards of a region that need to be set in a "       \
+          "remembered set bitmap container to convert it to a full "        \
+          "container covering the whole region.")                           \
+          range(1, 100)                                                     \
+                                                                            \
   develop(intx, G1MaxVerifyFailures, -1,                                    \
           "The maximum number of verification failures to print.  "         \
           "-1 means print all.")                                            \
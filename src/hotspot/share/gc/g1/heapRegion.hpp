@@ -26,6 +26,7 @@
 #define SHARE_GC_G1_HEAPREGION_HPP
 
 #include "gc/g1/g1BlockOffsetTable.hpp"
+#include "gc/g1/g1EvacFailureObjectsSet.hpp"
 #include "gc/g1/g1HeapRegionTraceType.hpp"
 #include "gc/g1/g1SurvRateGroup.hpp"
 #include "gc/g1/heapRegionTracer.hpp"
@@ -75,7 +76,6 @@ class HeapRegion : public CHeapObj<mtGC> {
   HeapWord* _compaction_top;
 
   G1BlockOffsetTablePart _bot_part;
-  Mutex _par_alloc_lock;
   // When we need to retire an allocation region, while other threads
   // are also concurrently trying to allocate into it, we typically
   // allocate a dummy object at the end of the region to ensure that
@@ -198,6 +198,12 @@ public:
     _bot_part.update();
   }
 
+  // Update the BOT threshold after par_allocate() calls, which do not
+  // maintain it. Must not be called concurrently with allocation.
+  void update_bot_threshold() {
+    _bot_part.update_threshold();
+  }
+
 private:
   // The remembered set for this region.
   HeapRegionRemSet* _rem_set;
@@ -256,6 +262,13 @@ private:
 
   uint _node_index;
 
+  // Number of objects in this region pinned by JNI critical sections. Objects
+  // in regions with pinned objects are not moved during garbage collection.
+  volatile size_t _pinned_object_count;
+
+  // Collects objects that failed evacuation in this region.
+  G1EvacFailureObjectsSet _evac_failure_objs;
+
   void report_region_type_change(G1HeapRegionTraceType::Type to);
 
   // Returns whether the given object address refers to a dead object, and either the
@@ -405,6 +418,11 @@ public:
   // Humongous regions and archive regions are pinned.
   bool is_pinned() const { return _type.is_pinned(); }
 
+  inline bool has_pinned_objects() const;
+  inline size_t pinned_count() const;
+  inline void increment_pinned_object_count();
+  inline void decrement_pinned_object_count();
+
   // An archive region is a pinned region, also tagged as old, which
   // should not be marked during mark/sweep. This allows the address
   // space to be shared by JVM instances.
@@ -504,6 +522,12 @@ public:
   // objects during evac failure handling.
   void note_self_forwarding_removal_end(size_t marked_bytes);
 
+  // Record an object that failed evacuation within this region.
+  void record_evac_failure_obj(oop obj);
+  // Applies the given closure to all previously recorded objects
+  // that failed evacuation in ascending address order.
+  void process_and_drop_evac_failure_objs(ObjectClosure* closure);
+
   uint index_in_opt_cset() const {
     assert(has_index_in_opt_cset(), "Opt cset index not set.");
     return _index_in_opt_cset;
@@ -98,14 +98,18 @@ inline HeapWord* HeapRegion::par_allocate(size_t word_size) {
   return par_allocate(word_size, word_size, &temp);
 }
 
-// Because of the requirement of keeping "_offsets" up to date with the
-// allocations, we sequentialize these with a lock.  Therefore, best if
-// this is used for larger LAB allocations only.
+// The BOT entries of concurrently allocated blocks are disjoint, so they can be
+// updated without synchronization after the lock-free allocation. The BOT
+// threshold is brought up to date when the region stops being an allocation
+// region, see update_bot_threshold().
 inline HeapWord* HeapRegion::par_allocate(size_t min_word_size,
                                           size_t desired_word_size,
                                           size_t* actual_size) {
-  MutexLocker x(&_par_alloc_lock);
-  return allocate(min_word_size, desired_word_size, actual_size);
+  HeapWord* res = par_allocate_impl(min_word_size, desired_word_size, actual_size);
+  if (res != NULL) {
+    _bot_part.par_alloc_block(res, *actual_size);
+  }
+  return res;
 }
 
 inline HeapWord* HeapRegion::block_start(const void* p) {
@@ -452,4 +456,21 @@ inline void HeapRegion::record_surv_words_in_group(size_t words_survived) {
   _surv_rate_group->record_surviving_words(age_in_group, words_survived);
 }
 
+inline bool HeapRegion::has_pinned_objects() const {
+  return pinned_count() > 0;
+}
+
+inline size_t HeapRegion::pinned_count() const {
+  return Atomic::load(&_pinned_object_count);
+}
+
+inline void HeapRegion::increment_pinned_object_count() {
+  Atomic::inc(&_pinned_object_count, memory_order_relaxed);
+}
+
+inline void HeapRegion::decrement_pinned_object_count() {
+  assert(pinned_count() > 0, "region %u has no pinned objects", hrm_index());
+  Atomic::dec(&_pinned_object_count, memory_order_relaxed);
+}
+
 #endif // SHARE_GC_G1_HEAPREGION_INLINE_HPP
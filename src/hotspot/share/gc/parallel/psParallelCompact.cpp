@@ -2264,46 +2264,79 @@ public:
   }
 };
 
-void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
-{
-  GCTraceTime(Trace, gc, phases) tm("Drain Task Setup", &_gc_timer);
-
-  // Find the threads that are active
-  uint worker_id = 0;
-
-  // Find all regions that are available (can be filled immediately) and
-  // distribute them to the thread stacks.  The iteration is done in reverse
-  // order (high to low) so the regions will be removed in ascending order.
-
-  const ParallelCompactData& sd = PSParallelCompact::summary_data();
+// Finds all regions that are available (can be filled immediately) and
+// distributes them to the region stacks of the workers. Workers claim chunks
+// of regions from high to low, and push the available regions of a chunk in
+// reverse order (high to low) so the regions will be removed in ascending
+// order.
+class FillableRegionsTask : public AbstractGangTask {
+  static const size_t RegionsPerChunk = 256;
+
+  // The ranges [beg, end) of regions to consider in each space.
+  size_t _beg_region[PSParallelCompact::last_space_id];
+  size_t _end_region[PSParallelCompact::last_space_id];
+
+  // Number of regions claimed from the top of each space.
+  volatile size_t _claimed[PSParallelCompact::last_space_id];
+
+  bool claim_chunk(unsigned int id, size_t& beg, size_t& end) {
+    const size_t num_regions = _end_region[id] - _beg_region[id];
+    if (Atomic::load(&_claimed[id]) >= num_regions) {
+      return false;
+    }
+    const size_t claimed = Atomic::fetch_and_add(&_claimed[id], RegionsPerChunk);
+    if (claimed >= num_regions) {
+      return false;
+    }
+    end = _end_region[id] - claimed;
+    beg = end - MIN2(RegionsPerChunk, num_regions - claimed);
+    return true;
+  }
 
-  // id + 1 is used to test termination so unsigned  can
-  // be used with an old_space_id == 0.
-  FillableRegionLogger region_logger;
-  for (unsigned int id = to_space_id; id + 1 > old_space_id; --id) {
-    SpaceInfo* const space_info = _space_info + id;
-    MutableSpace* const space = space_info->space();
-    HeapWord* const new_top = space_info->new_top();
+public:
+  FillableRegionsTask() : AbstractGangTask("FillableRegionsTask") {
+    const ParallelCompactData& sd = PSParallelCompact::summary_data();
+    for (unsigned int id = PSParallelCompact::old_space_id; id < PSParallelCompact::last_space_id; ++id) {
+      const PSParallelCompact::SpaceId space_id = PSParallelCompact::SpaceId(id);
+      _beg_region[id] = sd.addr_to_region_idx(PSParallelCompact::dense_prefix(space_id));
+      _end_region[id] = sd.addr_to_region_idx(sd.region_align_up(PSParallelCompact::new_top(space_id)));
+      _claimed[id] = 0;
+    }
+  }
 
-    const size_t beg_region = sd.addr_to_region_idx(space_info->dense_prefix());
-    const size_t end_region =
-      sd.addr_to_region_idx(sd.region_align_up(new_top));
-
-    for (size_t cur = end_region - 1; cur + 1 > beg_region; --cur) {
-      if (sd.region(cur)->claim_unsafe()) {
-        ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
-        bool result = sd.region(cur)->mark_normal();
-        assert(result, "Must succeed at this point.");
-        cm->region_stack()->push(cur);
-        region_logger.handle(cur);
-        // Assign regions to tasks in round-robin fashion.
-        if (++worker_id == parallel_gc_threads) {
-          worker_id = 0;
+  virtual void work(uint worker_id) {
+    ParallelCompactData& sd = PSParallelCompact::summary_data();
+    ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
+    FillableRegionLogger region_logger;
+
+    // id + 1 is used to test termination so unsigned  can
+    // be used with an old_space_id == 0.
+    for (unsigned int id = PSParallelCompact::to_space_id; id + 1 > PSParallelCompact::old_space_id; --id) {
+      size_t beg;
+      size_t end;
+      while (claim_chunk(id, beg, end)) {
+        for (size_t cur = end - 1; cur + 1 > beg; --cur) {
+          // Every region is only visited by a single worker, and no region
+          // is claimed concurrently until compaction starts.
+          if (sd.region(cur)->claim_unsafe()) {
+            bool result = sd.region(cur)->mark_normal();
+            assert(result, "Must succeed at this point.");
+            cm->region_stack()->push(cur);
+            region_logger.handle(cur);
+          }
         }
       }
+      region_logger.print_line();
     }
-    region_logger.print_line();
   }
+};
+
+void PSParallelCompact::prepare_region_draining_tasks(uint parallel_gc_threads)
+{
+  GCTraceTime(Trace, gc, phases) tm("Drain Task Setup", &_gc_timer);
+
+  FillableRegionsTask task;
+  ParallelScavengeHeap::heap()->workers().run_task(&task, parallel_gc_threads);
 }
 
 class TaskQueue : StackObj {
@@ -141,6 +141,10 @@
              "Inject thread creation failures for "                         \
              "UseDynamicNumberOfGCThreads")                                 \
                                                                             \
+  product(bool, BindGCTaskThreadsToCPUs, false, EXPERIMENTAL,               \
+          "Bind each parallel GC worker thread to one of the processors "   \
+          "the VM may run on")                                              \
+                                                                            \
   product(size_t, HeapSizePerGCThread, ScaleForWordSize(32*M),              \
           "Size of heap (bytes) per GC thread used in calculating the "     \
           "number of GC threads")                                           \
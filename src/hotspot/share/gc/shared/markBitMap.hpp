@@ -93,6 +93,9 @@ public:
   inline bool par_mark(HeapWord* addr);
   inline bool par_mark(oop obj);
 
+  // Prefetch the mark of the given address for a later update.
+  inline void prefetch(HeapWord* addr) const;
+
   // Clear bitmap.
   void clear()                         { do_clear(_covered, true); }
   void clear_range(MemRegion mr)       { do_clear(mr, false);      }
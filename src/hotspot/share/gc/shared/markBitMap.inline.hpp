@@ -56,6 +56,10 @@ inline void MarkBitMap::clear(HeapWord* addr) {
   _bm.clear_bit(addr_to_offset(addr));
 }
 
+inline void MarkBitMap::prefetch(HeapWord* addr) const {
+  _bm.prefetch(addr_to_offset(addr));
+}
+
 inline bool MarkBitMap::par_mark(HeapWord* addr) {
   check_mark(addr);
   return _bm.par_set_bit(addr_to_offset(addr));
@@ -40,6 +40,11 @@ protected:
   ~SATBBufferClosure() { }
 
 public:
+  // Number of entries ahead of the current one for which implementations of
+  // do_buffer() prefetch the marking state. The entries of a buffer are
+  // scattered over the heap, so waiting for the mark bitmap dominates.
+  static const size_t PrefetchDistance = 8;
+
   // Process the SATB entries in the designated buffer range.
   virtual void do_buffer(void** buffer, size_t size) = 0;
 };
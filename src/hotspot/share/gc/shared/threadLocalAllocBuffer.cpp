@@ -25,8 +25,10 @@
 #include "precompiled.hpp"
 #include "compiler/compilerDefinitions.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/gcId.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
@@ -456,6 +458,22 @@ void ThreadLocalAllocStats::publish() {
                       _total_gc_waste * HeapWordSize, _max_gc_waste * HeapWordSize,
                       _total_refill_waste * HeapWordSize, _max_refill_waste * HeapWordSize);
 
+  EventTLABStatistics e;
+  if (e.should_commit()) {
+    e.set_gcId(GCId::current_or_undefined());
+    e.set_allocatingThreads(_allocating_threads);
+    e.set_refills(_total_refills);
+    e.set_maxRefills(_max_refills);
+    e.set_allocated(_total_allocations * HeapWordSize);
+    e.set_gcWaste(_total_gc_waste * HeapWordSize);
+    e.set_maxGcWaste(_max_gc_waste * HeapWordSize);
+    e.set_refillWaste(_total_refill_waste * HeapWordSize);
+    e.set_maxRefillWaste(_max_refill_waste * HeapWordSize);
+    e.set_slowAllocations(_total_slow_allocations);
+    e.set_maxSlowAllocations(_max_slow_allocations);
+    e.commit();
+  }
+
   if (UsePerfData) {
     _perf_allocating_threads      ->set_value(_allocating_threads);
     _perf_total_refills           ->set_value(_total_refills);
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/gcId.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/workgroup.hpp"
 #include "gc/shared/workerManager.hpp"
 #include "memory/allocation.hpp"
@@ -230,6 +231,11 @@ void GangWorker::run() {
 void GangWorker::initialize() {
   assert(_gang != NULL, "No gang to run in");
   os::set_priority(this, NearMaxPriority);
+  if (BindGCTaskThreadsToCPUs && gang()->are_GC_task_threads() && !gang()->are_ConcurrentGC_threads()) {
+    if (!os::bind_to_processor(id())) {
+      log_debug(gc, workgang)("Could not bind gang worker %s to processor", name());
+    }
+  }
   log_develop_trace(gc, workgang)("Running gang worker for gang %s id %u", gang()->name(), id());
   assert(!Thread::current()->is_VM_thread(), "VM thread should not be part"
          " of a work gang");
@@ -280,6 +280,8 @@ public:
   }
 
   virtual void work(uint worker_id) {
+    ShenandoahWorkerTimingsTracker timer(ShenandoahPhaseTimings::conc_class_unload_unlink_code_roots,
+                                         ShenandoahPhaseTimings::CodeCacheUnload, worker_id);
     ICRefillVerifierMark mark(_verifier);
     _iterator.nmethods_do(&_cl);
   }
@@ -296,6 +298,8 @@ void ShenandoahCodeRoots::unlink(WorkGang* workers, bool unloading_occurred) {
     ICRefillVerifier verifier;
 
     {
+      // Worker times are reset on every attempt, only the last one is reported
+      ShenandoahGCWorkerPhase worker_phase(ShenandoahPhaseTimings::conc_class_unload_unlink_code_roots);
       ShenandoahUnlinkTask task(unloading_occurred, &verifier);
       workers->run_task(&task);
       if (task.success()) {
@@ -340,6 +344,8 @@ public:
   }
 
   virtual void work(uint worker_id) {
+    ShenandoahWorkerTimingsTracker timer(ShenandoahPhaseTimings::conc_class_unload_purge_coderoots,
+                                         ShenandoahPhaseTimings::CodeCacheUnload, worker_id);
     _iterator.nmethods_do(&_cl);
   }
 };
@@ -347,6 +353,7 @@ public:
 void ShenandoahCodeRoots::purge(WorkGang* workers) {
   assert(ShenandoahHeap::heap()->unload_classes(), "Only when running concurrent class unloading");
 
+  ShenandoahGCWorkerPhase worker_phase(ShenandoahPhaseTimings::conc_class_unload_purge_coderoots);
   ShenandoahNMethodPurgeTask task;
   workers->run_task(&task);
 }
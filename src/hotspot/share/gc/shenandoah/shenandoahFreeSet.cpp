@@ -61,6 +61,16 @@ bool ShenandoahFreeSet::is_collector_free(size_t idx) const {
   return _collector_free_bitmap.at(idx);
 }
 
+size_t ShenandoahFreeSet::next_mutator_free(size_t idx) const {
+  const size_t end = _mutator_rightmost + 1;
+  if (idx >= end) {
+    return end;
+  }
+  // Searching the bitmap a word at a time skips over long runs of
+  // retired regions quickly.
+  return _mutator_free_bitmap.get_next_one_offset(idx, end);
+}
+
 HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool& in_new_region) {
   // Scan the bitmap looking for a first fit.
   //
@@ -79,12 +89,11 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     case ShenandoahAllocRequest::_alloc_shared: {
 
       // Try to allocate in the mutator view
-      for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
-        if (is_mutator_free(idx)) {
-          HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
-          if (result != NULL) {
-            return result;
-          }
+      for (size_t idx = next_mutator_free(_mutator_leftmost); idx <= _mutator_rightmost; idx = next_mutator_free(idx + 1)) {
+        assert(is_mutator_free(idx), "Must be free: " SIZE_FORMAT, idx);
+        HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+        if (result != NULL) {
+          return result;
         }
       }
 
@@ -227,16 +236,12 @@ void ShenandoahFreeSet::recompute_bounds() {
 
 void ShenandoahFreeSet::adjust_bounds() {
   // Rewind both mutator bounds until the next bit.
-  while (_mutator_leftmost < _max && !is_mutator_free(_mutator_leftmost)) {
-    _mutator_leftmost++;
-  }
+  _mutator_leftmost = _mutator_free_bitmap.get_next_one_offset(MIN2(_mutator_leftmost, _max), _max);
   while (_mutator_rightmost > 0 && !is_mutator_free(_mutator_rightmost)) {
     _mutator_rightmost--;
   }
   // Rewind both collector bounds until the next bit.
-  while (_collector_leftmost < _max && !is_collector_free(_collector_leftmost)) {
-    _collector_leftmost++;
-  }
+  _collector_leftmost = _collector_free_bitmap.get_next_one_offset(MIN2(_collector_leftmost, _max), _max);
   while (_collector_rightmost > 0 && !is_collector_free(_collector_rightmost)) {
     _collector_rightmost--;
   }
@@ -260,14 +265,21 @@ HeapWord* ShenandoahFreeSet::allocate_contiguous(ShenandoahAllocRequest& req) {
   size_t end = beg;
 
   while (true) {
-    if (end >= _max) {
-      // Hit the end, goodbye
+    if (end > _mutator_rightmost) {
+      // Hit the end, goodbye. There are no free regions beyond the right-most one.
       return NULL;
     }
 
-    // If regions are not adjacent, then current [beg; end] is useless, and we may fast-forward.
+    // If regions are not adjacent, then current [beg; end] is useless, and we may fast-forward
+    // to the next free region.
+    if (!is_mutator_free(end)) {
+      end = next_mutator_free(end + 1);
+      beg = end;
+      continue;
+    }
+
     // If region is not completely free, the current [beg; end] is useless, and we may fast-forward.
-    if (!is_mutator_free(end) || !can_allocate_from(_heap->get_region(end))) {
+    if (!can_allocate_from(_heap->get_region(end))) {
       end++;
       beg = end;
       continue;
@@ -48,6 +48,10 @@ private:
   bool is_mutator_free(size_t idx) const;
   bool is_collector_free(size_t idx) const;
 
+  // Returns the index of the first mutator free region at or after idx,
+  // or _mutator_rightmost + 1 if there is none.
+  size_t next_mutator_free(size_t idx) const;
+
   HeapWord* try_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_single(ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_contiguous(ShenandoahAllocRequest& req);
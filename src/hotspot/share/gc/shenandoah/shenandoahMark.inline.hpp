@@ -232,6 +232,9 @@ public:
   template<StringDedupMode STRING_DEDUP>
   void do_buffer_impl(void **buffer, size_t size) {
     for (size_t i = 0; i < size; ++i) {
+      if (i + PrefetchDistance < size) {
+        _mark_context->prefetch_mark(cast_to_oop(buffer[i + PrefetchDistance]));
+      }
       oop *p = (oop *) &buffer[i];
       ShenandoahMark::mark_through_ref<oop, STRING_DEDUP>(p, _queue, _mark_context, &_stringdedup_requests, false);
     }
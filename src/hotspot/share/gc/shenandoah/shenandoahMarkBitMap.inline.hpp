@@ -29,6 +29,7 @@
 #include "gc/shenandoah/shenandoahMarkBitMap.hpp"
 
 #include "runtime/atomic.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/count_trailing_zeros.hpp"
 
 inline size_t ShenandoahMarkBitMap::address_to_index(const HeapWord* addr) const {
@@ -108,6 +109,12 @@ inline bool ShenandoahMarkBitMap::is_marked(HeapWord* addr) const {
   return (*word_addr(index) & mask) != 0;
 }
 
+inline void ShenandoahMarkBitMap::prefetch(HeapWord* addr) const {
+  idx_t index = address_to_index(addr);
+  verify_index(index);
+  Prefetch::write((void*)word_addr(index), 0);
+}
+
 template<ShenandoahMarkBitMap::bm_word_t flip, bool aligned_right>
 inline ShenandoahMarkBitMap::idx_t ShenandoahMarkBitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) const {
   STATIC_ASSERT(flip == find_ones_flip || flip == find_zeros_flip);
@@ -67,6 +67,8 @@ public:
   inline bool is_marked_strong(oop obj) const;
   inline bool is_marked_weak(oop obj) const;
 
+  inline void prefetch_mark(oop obj) const;
+
   inline HeapWord* get_next_marked_addr(HeapWord* addr, HeapWord* limit) const;
 
   inline bool allocated_after_mark_start(oop obj) const;
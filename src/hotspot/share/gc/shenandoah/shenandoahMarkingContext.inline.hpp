@@ -41,6 +41,10 @@ inline bool ShenandoahMarkingContext::is_marked(oop obj) const {
   return allocated_after_mark_start(obj) || _mark_bit_map.is_marked(cast_from_oop<HeapWord *>(obj));
 }
 
+inline void ShenandoahMarkingContext::prefetch_mark(oop obj) const {
+  _mark_bit_map.prefetch(cast_from_oop<HeapWord*>(obj));
+}
+
 inline bool ShenandoahMarkingContext::is_marked_strong(oop obj) const {
   return allocated_after_mark_start(obj) || _mark_bit_map.is_marked_strong(cast_from_oop<HeapWord*>(obj));
 }
@@ -182,6 +182,8 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   Atomic::xchg(&_budget, (intptr_t)initial, memory_order_relaxed);
   Atomic::store(&_tax_rate, tax_rate);
+  Atomic::store(&_allocated, (size_t)0);
+  Atomic::store(&_allocating_threads, (size_t)0);
   Atomic::inc(&_epoch);
 
   // Shake up stalled waiters after budget update.
@@ -222,9 +224,36 @@ intptr_t ShenandoahPacer::epoch() {
   return Atomic::load(&_epoch);
 }
 
+size_t ShenandoahPacer::account_alloc(Thread* thread, size_t words) {
+  // Threads allocating concurrently with the budget update may account
+  // their allocation to the wrong epoch. This only makes the fair share
+  // slightly off for a short while.
+  const intptr_t epoch = Atomic::load(&_epoch);
+  size_t thread_words = ShenandoahThreadLocalData::paced_words(thread, epoch);
+  if (thread_words == 0) {
+    Atomic::inc(&_allocating_threads, memory_order_relaxed);
+  }
+  Atomic::add(&_allocated, words, memory_order_relaxed);
+
+  thread_words += words;
+  ShenandoahThreadLocalData::set_paced_words(thread, epoch, thread_words);
+  return thread_words;
+}
+
+bool ShenandoahPacer::is_heavy_allocator(size_t thread_words) const {
+  // A thread is a heavy allocator if it allocated at least the average
+  // of all allocating threads in this epoch.
+  const size_t allocated = Atomic::load(&_allocated);
+  const size_t allocating_threads = Atomic::load(&_allocating_threads);
+  return (julong)thread_words * allocating_threads >= (julong)allocated;
+}
+
 void ShenandoahPacer::pace_for_alloc(size_t words) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
+  JavaThread* const thread = JavaThread::current();
+  const size_t thread_words = account_alloc(thread, words);
+
   // Fast path: try to allocate right away
   bool claimed = claim_for_alloc(words, false);
   if (claimed) {
@@ -241,7 +270,14 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
   // Threads that are attaching should not block at all: they are not
   // fully initialized yet. Blocking them would be awkward.
   // This is probably the path that allocates the thread oop itself.
-  if (JavaThread::current()->is_attaching_via_jni()) {
+  if (thread->is_attaching_via_jni()) {
+    return;
+  }
+
+  // Threads that allocated less than their fair share do not wait. Their
+  // claims are matched by additional progress, for which the heavier
+  // allocators wait instead.
+  if (!is_heavy_allocator(thread_words)) {
     return;
   }
 
@@ -264,7 +300,7 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
       //     Breaking out and allocating anyway, which may mean we outpace GC,
       //     and start Degenerated GC cycle.
       //  b) The budget had been replenished, which means our claim is satisfied.
-      ShenandoahThreadLocalData::add_paced_time(JavaThread::current(), end - start);
+      ShenandoahThreadLocalData::add_paced_time(thread, end - start);
       break;
     }
   }
@@ -39,6 +39,9 @@ class ShenandoahHeap;
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ * When the credit is not available, only the threads that allocated at least
+ * their fair share since the last budget update are stalled, so that the heaviest
+ * allocators are paced first.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -62,6 +65,12 @@ private:
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Words allocated by, and number of, paced allocating threads in this epoch
+  shenandoah_padding(4);
+  volatile size_t _allocated;
+  volatile size_t _allocating_threads;
+  shenandoah_padding(5);
+
 public:
   ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
@@ -71,7 +80,9 @@ public:
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {}
+          _progress(PACING_PROGRESS_UNINIT),
+          _allocated(0),
+          _allocating_threads(0) {}
 
   void setup_for_idle();
   void setup_for_mark();
@@ -106,6 +117,9 @@ private:
 
   size_t update_and_get_progress_history();
 
+  size_t account_alloc(Thread* thread, size_t words);
+  bool is_heavy_allocator(size_t thread_words) const;
+
   void wait(size_t time_ms);
 };
 
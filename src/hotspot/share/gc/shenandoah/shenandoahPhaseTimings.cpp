@@ -117,6 +117,8 @@ bool ShenandoahPhaseTimings::is_worker_phase(Phase phase) {
     case conc_weak_roots_work:
     case conc_weak_refs:
     case conc_strong_roots:
+    case conc_class_unload_unlink_code_roots:
+    case conc_class_unload_purge_coderoots:
       return true;
     default:
       return false;
@@ -156,7 +158,8 @@ void ShenandoahPhaseTimings::record_workers_start(Phase phase) {
 
   // Special case: these phases can enter multiple times, need to reset
   // their worker data every time.
-  if (phase == heap_iteration_roots) {
+  if (phase == heap_iteration_roots ||
+      phase == conc_class_unload_unlink_code_roots) {
     for (uint i = 1; i < _num_par_phases; i++) {
       worker_data(phase, ParPhase(i))->reset();
     }
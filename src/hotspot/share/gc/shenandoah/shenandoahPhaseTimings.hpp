@@ -87,9 +87,11 @@ class outputStream;
   f(conc_class_unload_unlink_sd,                    "    System Dictionary")           \
   f(conc_class_unload_unlink_weak_klass,            "    Weak Class Links")            \
   f(conc_class_unload_unlink_code_roots,            "    Code Roots")                  \
+  SHENANDOAH_PAR_PHASE_DO(conc_class_unload_unlink_code_roots_, "      CUCR: ", f)     \
   f(conc_class_unload_rendezvous,                   "  Rendezvous")                    \
   f(conc_class_unload_purge,                        "  Purge Unlinked")                \
   f(conc_class_unload_purge_coderoots,              "    Code Roots")                  \
+  SHENANDOAH_PAR_PHASE_DO(conc_class_unload_purge_coderoots_, "      CPCR: ", f)       \
   f(conc_class_unload_purge_cldg,                   "    CLDG")                        \
   f(conc_class_unload_purge_ec,                     "    Exception Caches")            \
   f(conc_strong_roots,                              "Concurrent Strong Roots")         \
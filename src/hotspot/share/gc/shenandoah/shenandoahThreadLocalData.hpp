@@ -50,6 +50,8 @@ private:
   uint  _worker_id;
   int  _disarmed_value;
   double _paced_time;
+  intptr_t _paced_epoch;
+  size_t _paced_words;
 
   ShenandoahThreadLocalData() :
     _gc_state(0),
@@ -60,7 +62,9 @@ private:
     _gclab_size(0),
     _worker_id(INVALID_WORKER_ID),
     _disarmed_value(0),
-    _paced_time(0) {
+    _paced_time(0),
+    _paced_epoch(-1),
+    _paced_words(0) {
 
     // At least on x86_64, nmethod entry barrier encodes _disarmed_value offset
     // in instruction as disp8 immed
@@ -144,6 +148,19 @@ public:
     data(thread)->_paced_time = 0;
   }
 
+  // Returns the words allocated by the thread in the given pacing epoch,
+  // or 0 if the thread did not allocate in that epoch yet.
+  static size_t paced_words(Thread* thread, intptr_t epoch) {
+    ShenandoahThreadLocalData* const d = data(thread);
+    return d->_paced_epoch == epoch ? d->_paced_words : 0;
+  }
+
+  static void set_paced_words(Thread* thread, intptr_t epoch, size_t words) {
+    ShenandoahThreadLocalData* const d = data(thread);
+    d->_paced_epoch = epoch;
+    d->_paced_words = words;
+  }
+
   static void set_disarmed_value(Thread* thread, int value) {
     data(thread)->_disarmed_value = value;
   }
@@ -115,7 +115,6 @@ public:
 
   // Mark barrier
   static void mark_barrier_on_oop_field(volatile oop* p, bool finalizable);
-  static void mark_barrier_on_oop_array(volatile oop* p, size_t length, bool finalizable);
   static void mark_barrier_on_invisible_root_oop_field(oop* p);
 
   // Narrow oop variants, never used.
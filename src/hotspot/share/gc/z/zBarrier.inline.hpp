@@ -389,10 +389,4 @@ inline void ZBarrier::mark_barrier_on_oop_field(volatile oop* p, bool finalizabl
   }
 }
 
-inline void ZBarrier::mark_barrier_on_oop_array(volatile oop* p, size_t length, bool finalizable) {
-  for (volatile const oop* const end = p + length; p < end; p++) {
-    mark_barrier_on_oop_field(p, finalizable);
-  }
-}
-
 #endif // SHARE_GC_Z_ZBARRIER_INLINE_HPP
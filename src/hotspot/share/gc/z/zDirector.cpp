@@ -28,11 +28,33 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeuristics.hpp"
 #include "gc/z/zStat.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
 
 constexpr double one_in_1000 = 3.290527;
 constexpr double sample_interval = 1.0 / ZStatAllocRate::sample_hz;
 
+static double alloc_rate_sd_factor() {
+  // Number of standard deviations a normally distributed sample must be
+  // away from the average, such that the probability of it being outside
+  // of the confidence interval is ZAllocationStallProbability. Calculated
+  // using the rational approximation of the inverse of the normal
+  // distribution from Abramowitz and Stegun (26.2.23), which has an
+  // absolute error of less than 4.5e-4.
+  const double t = sqrt(-2.0 * log(ZAllocationStallProbability / 2.0));
+  return t - (2.515517 + (0.802853 * t) + (0.010328 * t * t)) /
+             (1.0 + (1.432788 * t) + (0.189269 * t * t) + (0.001308 * t * t * t));
+}
+
+static size_t free_excluding_headroom() {
+  // Calculate amount of free memory available. Note that we take the
+  // relocation headroom into account to avoid in-place relocation.
+  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
+  const size_t used = ZHeap::heap()->used();
+  const size_t free_including_headroom = soft_max_capacity - MIN2(soft_max_capacity, used);
+  return free_including_headroom - MIN2(free_including_headroom, ZHeuristics::relocation_headroom());
+}
+
 ZDirector::ZDirector(ZDriver* driver) :
     _driver(driver),
     _metronome(ZStatAllocRate::sample_hz) {
@@ -174,24 +196,20 @@ ZDriverRequest rule_allocation_rate_dynamic() {
     return GCCause::_no_gc;
   }
 
-  // Calculate amount of free memory available. Note that we take the
-  // relocation headroom into account to avoid in-place relocation.
-  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
-  const size_t used = ZHeap::heap()->used();
-  const size_t free_including_headroom = soft_max_capacity - MIN2(soft_max_capacity, used);
-  const size_t free = free_including_headroom - MIN2(free_including_headroom, ZHeuristics::relocation_headroom());
+  const size_t free = free_excluding_headroom();
 
   // Calculate time until OOM given the max allocation rate and the amount
-  // of free memory. The allocation rate is a moving average and we multiply
-  // that with an allocation spike tolerance factor to guard against unforeseen
-  // phase changes in the allocate rate. We then add ~3.3 sigma to account for
-  // the allocation rate variance, which means the probability is 1 in 1000
-  // that a sample is outside of the confidence interval.
+  // of free memory. The allocation rate is the larger of the moving average
+  // and the prediction based on its recent trend, and we multiply that with
+  // an allocation spike tolerance factor to guard against unforeseen phase
+  // changes in the allocate rate. We then add enough sigma to account for
+  // the allocation rate variance, such that the probability that a sample
+  // is outside of the confidence interval is ZAllocationStallProbability.
   const double alloc_rate_predict = ZStatAllocRate::predict();
   const double alloc_rate_avg = ZStatAllocRate::avg();
   const double alloc_rate_sd = ZStatAllocRate::sd();
   const double alloc_rate_sd_percent = alloc_rate_sd / (alloc_rate_avg + 1.0);
-  const double alloc_rate = (MAX2(alloc_rate_predict, alloc_rate_avg) * ZAllocationSpikeTolerance) + (alloc_rate_sd * one_in_1000) + 1.0;
+  const double alloc_rate = (MAX2(alloc_rate_predict, alloc_rate_avg) * ZAllocationSpikeTolerance) + (alloc_rate_sd * alloc_rate_sd_factor()) + 1.0;
   const double time_until_oom = (free / alloc_rate) / (1.0 + alloc_rate_sd_percent);
 
   // Calculate max serial/parallel times of a GC cycle. The times are
@@ -247,20 +265,19 @@ static ZDriverRequest rule_allocation_rate_static() {
   // margin based on variations in the allocation rate and unforeseen
   // allocation spikes.
 
-  // Calculate amount of free memory available. Note that we take the
-  // relocation headroom into account to avoid in-place relocation.
-  const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
-  const size_t used = ZHeap::heap()->used();
-  const size_t free_including_headroom = soft_max_capacity - MIN2(soft_max_capacity, used);
-  const size_t free = free_including_headroom - MIN2(free_including_headroom, ZHeuristics::relocation_headroom());
+  const size_t free = free_excluding_headroom();
 
   // Calculate time until OOM given the max allocation rate and the amount
-  // of free memory. The allocation rate is a moving average and we multiply
-  // that with an allocation spike tolerance factor to guard against unforeseen
-  // phase changes in the allocate rate. We then add ~3.3 sigma to account for
-  // the allocation rate variance, which means the probability is 1 in 1000
-  // that a sample is outside of the confidence interval.
-  const double max_alloc_rate = (ZStatAllocRate::avg() * ZAllocationSpikeTolerance) + (ZStatAllocRate::sd() * one_in_1000);
+  // of free memory. The allocation rate is the larger of the moving average
+  // and the prediction based on its recent trend, and we multiply that with
+  // an allocation spike tolerance factor to guard against unforeseen phase
+  // changes in the allocate rate. We then add enough sigma to account for
+  // the allocation rate variance, such that the probability that a sample
+  // is outside of the confidence interval is ZAllocationStallProbability.
+  const double alloc_rate_predict = ZStatAllocRate::predict();
+  const double alloc_rate_avg = ZStatAllocRate::avg();
+  const double alloc_rate_sd = ZStatAllocRate::sd();
+  const double max_alloc_rate = (MAX2(alloc_rate_predict, alloc_rate_avg) * ZAllocationSpikeTolerance) + (alloc_rate_sd * alloc_rate_sd_factor());
   const double time_until_oom = free / (max_alloc_rate + 1.0); // Plus 1.0B/s to avoid division by zero
 
   // Calculate max serial/parallel times of a GC cycle. The times are
@@ -301,12 +318,8 @@ static ZDriverRequest rule_high_usage() {
   // memory is still slowly but surely heading towards zero. In this situation,
   // we start a GC cycle to avoid a potential allocation stall later.
 
-  // Calculate amount of free memory available. Note that we take the
-  // relocation headroom into account to avoid in-place relocation.
   const size_t soft_max_capacity = ZHeap::heap()->soft_max_capacity();
-  const size_t used = ZHeap::heap()->used();
-  const size_t free_including_headroom = soft_max_capacity - MIN2(soft_max_capacity, used);
-  const size_t free = free_including_headroom - MIN2(free_including_headroom, ZHeuristics::relocation_headroom());
+  const size_t free = free_excluding_headroom();
   const double free_percent = percent_of(free, soft_max_capacity);
 
   log_debug(gc, director)("Rule: High Usage, Free: " SIZE_FORMAT "MB(%.1f%%)",
@@ -389,6 +402,19 @@ static ZDriverRequest make_gc_decision() {
   return GCCause::_no_gc;
 }
 
+static void send_decision_event(const ZDriverRequest& request) {
+  EventZDirectorDecision event;
+  if (event.should_commit()) {
+    event.set_cause((u2)request.cause());
+    event.set_gcWorkers(request.nworkers());
+    event.set_allocationRate(ZStatAllocRate::avg());
+    event.set_predictedAllocationRate(ZStatAllocRate::predict());
+    event.set_allocationRateStdDev(ZStatAllocRate::sd());
+    event.set_free(free_excluding_headroom());
+    event.commit();
+  }
+}
+
 void ZDirector::run_service() {
   // Main loop
   while (_metronome.wait_for_tick()) {
@@ -396,6 +422,7 @@ void ZDirector::run_service() {
     if (!_driver->is_busy()) {
       const ZDriverRequest request = make_gc_decision();
       if (request.cause() != GCCause::_no_gc) {
+        send_decision_event(request);
         _driver->collect(request);
       }
     }
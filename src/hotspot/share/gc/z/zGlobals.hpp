@@ -56,6 +56,13 @@ const uint8_t     ZPageTypeSmall                = 0;
 const uint8_t     ZPageTypeMedium               = 1;
 const uint8_t     ZPageTypeLarge                = 2;
 
+// Page ages, i.e. the number of times the objects on a page have been
+// relocated by GC workers, saturating at ZPageAgeOld
+const uint8_t     ZPageAgeEden                  = 0;
+const uint8_t     ZPageAgeSurvivor              = 1;
+const uint8_t     ZPageAgeOld                   = 2;
+const uint8_t     ZPageAgeCount                 = 3;
+
 // Page size shifts
 const size_t      ZPageSizeSmallShift           = ZGranuleSizeShift;
 extern size_t     ZPageSizeMediumShift;
@@ -148,6 +155,9 @@ const size_t      ZMarkCacheSize                = 1024; // Must be a power of tw
 const size_t      ZMarkPartialArrayMinSizeShift = 12; // 4K
 const size_t      ZMarkPartialArrayMinSize      = (size_t)1 << ZMarkPartialArrayMinSizeShift;
 
+// Number of array elements to look ahead when prefetching mark bits
+const size_t      ZMarkPrefetchDistance         = 8;
+
 // Max number of proactive/terminate flush attempts
 const size_t      ZMarkProactiveFlushMax        = 10;
 const size_t      ZMarkTerminateFlushMax        = 3;
@@ -81,6 +81,7 @@ public:
 
   bool get(size_t index) const;
   bool set(size_t index, bool finalizable, bool& inc_live);
+  void prefetch(size_t index) const;
 
   void inc_live(uint32_t objects, size_t bytes);
 
@@ -103,6 +103,10 @@ inline bool ZLiveMap::get(size_t index) const {
          _bitmap.at(index);          // Object is marked
 }
 
+inline void ZLiveMap::prefetch(size_t index) const {
+  _bitmap.prefetch(index);
+}
+
 inline bool ZLiveMap::set(size_t index, bool finalizable, bool& inc_live) {
   if (!is_marked()) {
     // First object to be marked during this
@@ -159,7 +159,7 @@ bool ZMark::is_array(uintptr_t addr) const {
 void ZMark::push_partial_array(uintptr_t addr, size_t size, bool finalizable) {
   assert(is_aligned(addr, ZMarkPartialArrayMinSize), "Address misaligned");
   ZMarkThreadLocalStacks* const stacks = ZThreadLocalData::stacks(Thread::current());
-  ZMarkStripe* const stripe = _stripes.stripe_for_addr(addr);
+  ZMarkStripe* const stripe = _stripes.stripe_for_partial_array(addr);
   const uintptr_t offset = ZAddress::offset(addr) >> ZMarkPartialArrayMinSizeShift;
   const uintptr_t length = size / oopSize;
   const ZMarkStackEntry entry(offset, length, finalizable);
@@ -176,7 +176,29 @@ void ZMark::follow_small_array(uintptr_t addr, size_t size, bool finalizable) {
 
   log_develop_trace(gc, marking)("Array follow small: " PTR_FORMAT " (" SIZE_FORMAT ")", addr, size);
 
-  ZBarrier::mark_barrier_on_oop_array((oop*)addr, length, finalizable);
+  volatile oop* const start = (volatile oop*)addr;
+  volatile oop* const end = start + length;
+
+  for (volatile oop* p = start; p < end; p++) {
+    // Prefetch the mark bits of an upcoming element, which the mark
+    // barrier will otherwise most likely have to wait for.
+    if (p + ZMarkPrefetchDistance < end) {
+      prefetch_mark(Atomic::load(p + ZMarkPrefetchDistance));
+    }
+
+    ZBarrier::mark_barrier_on_oop_field(p, finalizable);
+  }
+}
+
+void ZMark::prefetch_mark(oop o) const {
+  const uintptr_t addr = ZOop::to_address(o);
+  if (!ZAddress::is_good(addr)) {
+    // Null or bad oops go through the slow path of the mark barrier,
+    // which will remap them first. Don't bother prefetching those.
+    return;
+  }
+
+  _page_table->get(addr)->prefetch_mark(addr);
 }
 
 void ZMark::follow_large_array(uintptr_t addr, size_t size, bool finalizable) {
@@ -58,6 +58,7 @@ private:
 
   bool is_array(uintptr_t addr) const;
   void push_partial_array(uintptr_t addr, size_t size, bool finalizable);
+  void prefetch_mark(oop o) const;
   void follow_small_array(uintptr_t addr, size_t size, bool finalizable);
   void follow_large_array(uintptr_t addr, size_t size, bool finalizable);
   void follow_array(uintptr_t addr, size_t size, bool finalizable);
@@ -109,6 +109,7 @@ public:
   ZMarkStripe* stripe_next(ZMarkStripe* stripe);
   ZMarkStripe* stripe_for_worker(uint nworkers, uint worker_id);
   ZMarkStripe* stripe_for_addr(uintptr_t addr);
+  ZMarkStripe* stripe_for_partial_array(uintptr_t addr);
 };
 
 class ZMarkStackAllocator;
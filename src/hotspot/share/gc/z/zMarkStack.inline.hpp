@@ -26,6 +26,8 @@
 
 #include "gc/z/zMarkStack.hpp"
 
+#include "gc/z/zAddress.inline.hpp"
+
 #include "utilities/debug.hpp"
 #include "runtime/atomic.hpp"
 
@@ -217,6 +219,18 @@ inline ZMarkStripe* ZMarkStripeSet::stripe_for_addr(uintptr_t addr) {
   return &_stripes[index];
 }
 
+inline ZMarkStripe* ZMarkStripeSet::stripe_for_partial_array(uintptr_t addr) {
+  // Many partial arrays of the same large array are located within the
+  // same stripe granule, so selecting the stripe by address would put
+  // them all on the same stripe. Instead, spread them out by hashing the
+  // partial array index, so that more workers find them on their own
+  // stripe instead of having to steal them.
+  const uint64_t partial_index = ZAddress::offset(addr) >> ZMarkPartialArrayMinSizeShift;
+  const size_t index = (size_t)((partial_index * UCONST64(0x9E3779B97F4A7C15)) >> 32) & _nstripes_mask;
+  assert(index < _nstripes, "Invalid index");
+  return &_stripes[index];
+}
+
 inline void ZMarkThreadLocalStacks::install(ZMarkStripeSet* stripes,
                                             ZMarkStripe* stripe,
                                             ZMarkStack* stack) {
@@ -37,6 +37,7 @@ class ZPage : public CHeapObj<mtGC> {
 private:
   uint8_t            _type;
   uint8_t            _numa_id;
+  uint8_t            _age;
   uint32_t           _seqnum;
   ZVirtualMemory     _virtual;
   volatile uintptr_t _top;
@@ -75,6 +76,9 @@ public:
 
   uint8_t numa_id();
 
+  uint8_t age() const;
+  void set_age(uint8_t age);
+
   bool is_allocating() const;
   bool is_relocatable() const;
 
@@ -96,6 +100,7 @@ public:
   bool is_object_live(uintptr_t addr) const;
   bool is_object_strongly_live(uintptr_t addr) const;
   bool mark_object(uintptr_t addr, bool finalizable, bool& inc_live);
+  void prefetch_mark(uintptr_t addr) const;
 
   void inc_live(uint32_t objects, size_t bytes);
   uint32_t live_objects() const;
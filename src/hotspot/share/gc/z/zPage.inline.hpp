@@ -145,6 +145,15 @@ inline uint8_t ZPage::numa_id() {
   return _numa_id;
 }
 
+inline uint8_t ZPage::age() const {
+  return _age;
+}
+
+inline void ZPage::set_age(uint8_t age) {
+  assert(age < ZPageAgeCount, "Invalid age");
+  _age = age;
+}
+
 inline bool ZPage::is_allocating() const {
   return _seqnum == ZGlobalSeqNum;
 }
@@ -206,6 +215,14 @@ inline bool ZPage::mark_object(uintptr_t addr, bool finalizable, bool& inc_live)
   return _livemap.set(index, finalizable, inc_live);
 }
 
+inline void ZPage::prefetch_mark(uintptr_t addr) const {
+  assert(is_in(addr), "Invalid address");
+
+  // Prefetch the live map word holding the mark bits
+  const size_t index = ((ZAddress::offset(addr) - start()) >> object_alignment_shift()) * 2;
+  _livemap.prefetch(index);
+}
+
 inline void ZPage::inc_live(uint32_t objects, size_t bytes) {
   _livemap.inc_live(objects, bytes);
 }
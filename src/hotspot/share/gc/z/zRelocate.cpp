@@ -125,6 +125,11 @@ uintptr_t ZRelocate::forward_object(ZForwarding* forwarding, uintptr_t from_addr
   return to_addr;
 }
 
+// The age of the pages objects from the given forwarding are relocated to.
+static uint8_t target_age(const ZForwarding* forwarding) {
+  return MIN2((uint8_t)(forwarding->age() + 1), ZPageAgeOld);
+}
+
 static ZPage* alloc_page(const ZForwarding* forwarding) {
   if (ZStressRelocateInPlace) {
     // Simulate failure to allocate a new page. This will
@@ -135,7 +140,11 @@ static ZPage* alloc_page(const ZForwarding* forwarding) {
   ZAllocationFlags flags;
   flags.set_non_blocking();
   flags.set_worker_relocation();
-  return ZHeap::heap()->alloc_page(forwarding->type(), forwarding->size(), flags);
+  ZPage* const page = ZHeap::heap()->alloc_page(forwarding->type(), forwarding->size(), flags);
+  if (page != NULL) {
+    page->set_age(target_age(forwarding));
+  }
+  return page;
 }
 
 static void free_page(ZPage* page) {
@@ -158,6 +167,12 @@ public:
   ZRelocateSmallAllocator() :
       _in_place_count(0) {}
 
+  // Each worker keeps a separate target page per target age, segregating
+  // objects by the number of times they survived relocation.
+  uint8_t target_slot(const ZForwarding* forwarding) const {
+    return target_age(forwarding);
+  }
+
   ZPage* alloc_target_page(ZForwarding* forwarding, ZPage* target) {
     ZPage* const page = alloc_page(forwarding);
     if (page == NULL) {
@@ -208,6 +223,12 @@ public:
       _in_place(false),
       _in_place_count(0) {}
 
+  // The target page is shared between all workers, and used for objects of
+  // all ages.
+  uint8_t target_slot(const ZForwarding* forwarding) const {
+    return 0;
+  }
+
   ~ZRelocateMediumAllocator() {
     if (should_free_target_page(_shared)) {
       free_page(_shared);
@@ -276,7 +297,9 @@ class ZRelocateClosure : public ObjectClosure {
 private:
   Allocator* const _allocator;
   ZForwarding*     _forwarding;
+  ZPage*           _targets[ZPageAgeCount];
   ZPage*           _target;
+  uint8_t          _target_slot;
 
   bool relocate_object(uintptr_t from_addr) const {
     ZForwardingCursor cursor;
@@ -328,8 +351,10 @@ private:
       // Claim the page being relocated to block other threads from accessing
       // it, or its forwarding table, until it has been released (relocation
       // completed).
+      const uint8_t age = target_age(_forwarding);
       _target = _forwarding->claim_page();
       _target->reset_for_in_place_relocation();
+      _target->set_age(age);
       _forwarding->set_in_place();
     }
   }
@@ -338,15 +363,28 @@ public:
   ZRelocateClosure(Allocator* allocator) :
       _allocator(allocator),
       _forwarding(NULL),
-      _target(NULL) {}
+      _target(NULL),
+      _target_slot(0) {
+    for (uint8_t i = 0; i < ZPageAgeCount; i++) {
+      _targets[i] = NULL;
+    }
+  }
 
   ~ZRelocateClosure() {
-    _allocator->free_target_page(_target);
+    _targets[_target_slot] = _target;
+    for (uint8_t i = 0; i < ZPageAgeCount; i++) {
+      _allocator->free_target_page(_targets[i]);
+    }
   }
 
   void do_forwarding(ZForwarding* forwarding) {
     _forwarding = forwarding;
 
+    // Switch to the target page for the age of the objects to relocate
+    _targets[_target_slot] = _target;
+    _target_slot = _allocator->target_slot(forwarding);
+    _target = _targets[_target_slot];
+
     // Check if we should abort
     if (ZAbort::should_abort()) {
       _forwarding->abort_page();
@@ -35,6 +35,11 @@
   product(double, ZAllocationSpikeTolerance, 2.0,                           \
           "Allocation spike tolerance factor")                              \
                                                                             \
+  product(double, ZAllocationStallProbability, 0.001, EXPERIMENTAL,         \
+          "Accepted probability that the allocation rate is higher than "   \
+          "the estimated max allocation rate used to schedule GC cycles")   \
+          range(0.000001, 0.5)                                              \
+                                                                            \
   product(double, ZFragmentationLimit, 25.0,                                \
           "Maximum allowed heap fragmentation")                             \
                                                                             \
@@ -431,12 +431,14 @@ void InterpreterOopMap::resource_copy(OopMapCacheEntry* from) {
 }
 
 inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int bci) const {
-  // We use method->code_size() rather than method->identity_hash() below since
-  // the mark may not be present if a pointer to the method is already reversed.
-  return   ((unsigned int) bci)
-         ^ ((unsigned int) method->max_locals()         << 2)
-         ^ ((unsigned int) method->code_size()          << 4)
-         ^ ((unsigned int) method->size_of_parameters() << 6);
+  // The Method* does not move during its lifetime, so use its address to tell
+  // apart methods of the same shape, which otherwise all hash the same for a
+  // given bci. Entries are matched by method and bci, so collisions are benign.
+  uintptr_t addr = (uintptr_t) method();
+  unsigned int hash = (unsigned int) (addr >> LogBytesPerWord)
+                    ^ (unsigned int) (addr >> (LogBytesPerWord + 8));
+  hash = hash * 31 + (unsigned int) bci;
+  return hash % _size;
 }
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = NULL;
@@ -147,7 +147,7 @@ class InterpreterOopMap: ResourceObj {
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
  private:
-  enum { _size        = 32,     // Use fixed size for now
+  enum { _size        = 64,     // Use fixed size for now
          _probe_depth = 3       // probe depth in case of collisions
   };
 
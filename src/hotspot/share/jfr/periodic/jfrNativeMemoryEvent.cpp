@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/periodic/jfrNativeMemoryEvent.hpp"
+#include "jfr/utilities/jfrTime.hpp"
+#include "services/mallocTracker.hpp"
+#include "services/memTracker.hpp"
+#include "services/nmtCommon.hpp"
+#include "services/threadStackTracker.hpp"
+#include "services/virtualMemoryTracker.hpp"
+#include "utilities/macros.hpp"
+
+#if INCLUDE_NMT
+
+static bool take_snapshots(MallocMemorySnapshot* malloc_snapshot, VirtualMemorySnapshot* vm_snapshot) {
+  if (MemTracker::tracking_level() < NMT_summary) {
+    return false;
+  }
+  MallocMemorySummary::snapshot(malloc_snapshot);
+  VirtualMemorySummary::snapshot(vm_snapshot);
+  return true;
+}
+
+// Attributes usage to memory types the same way as the summary report of
+// VM.native_memory (see MemSummaryReporter::report_summary_of_type).
+static void type_usage(MEMFLAGS flag, MallocMemorySnapshot* malloc_snapshot, VirtualMemorySnapshot* vm_snapshot,
+                       size_t* reserved, size_t* committed) {
+  const MallocMemory* const malloc_memory = malloc_snapshot->by_type(flag);
+  const VirtualMemory* const vm = vm_snapshot->by_type(flag);
+  const size_t malloced = malloc_memory->malloc_size() + malloc_memory->arena_size();
+  *reserved = malloced + vm->reserved();
+  *committed = malloced + vm->committed();
+
+  if (flag == mtThread) {
+    // Count thread's native stack in "Thread" category
+    if (ThreadStackTracker::track_as_vm()) {
+      const VirtualMemory* const thread_stack_usage = vm_snapshot->by_type(mtThreadStack);
+      *reserved += thread_stack_usage->reserved();
+      *committed += thread_stack_usage->committed();
+    } else {
+      const MallocMemory* const thread_stack_usage = malloc_snapshot->by_type(mtThreadStack);
+      *reserved += thread_stack_usage->malloc_size();
+      *committed += thread_stack_usage->malloc_size();
+    }
+  } else if (flag == mtNMT) {
+    // Count malloc headers in "NMT" category
+    *reserved += malloc_snapshot->malloc_overhead();
+    *committed += malloc_snapshot->malloc_overhead();
+  }
+}
+
+void JfrNativeMemoryEvent::send_type_events() {
+  MallocMemorySnapshot malloc_snapshot;
+  VirtualMemorySnapshot vm_snapshot;
+  if (!take_snapshots(&malloc_snapshot, &vm_snapshot)) {
+    return;
+  }
+  const JfrTicks timestamp = JfrTicks::now();
+  for (int index = 0; index < mt_number_of_types; index++) {
+    const MEMFLAGS flag = NMTUtil::index_to_flag(index);
+    // thread stack is reported as part of thread category
+    if (flag == mtThreadStack) continue;
+    size_t reserved;
+    size_t committed;
+    type_usage(flag, &malloc_snapshot, &vm_snapshot, &reserved, &committed);
+    EventNativeMemoryUsage event(UNTIMED);
+    event.set_starttime(timestamp);
+    event.set_endtime(timestamp);
+    event.set_type(NMTUtil::flag_to_name(flag));
+    event.set_reserved(reserved);
+    event.set_committed(committed);
+    event.commit();
+  }
+}
+
+void JfrNativeMemoryEvent::send_total_event() {
+  MallocMemorySnapshot malloc_snapshot;
+  VirtualMemorySnapshot vm_snapshot;
+  if (!take_snapshots(&malloc_snapshot, &vm_snapshot)) {
+    return;
+  }
+  EventNativeMemoryUsageTotal event;
+  event.set_reserved(malloc_snapshot.total() + vm_snapshot.total_reserved());
+  event.set_committed(malloc_snapshot.total() + vm_snapshot.total_committed());
+  event.commit();
+}
+
+#else // INCLUDE_NMT
+
+void JfrNativeMemoryEvent::send_type_events() {}
+void JfrNativeMemoryEvent::send_total_event() {}
+
+#endif // INCLUDE_NMT
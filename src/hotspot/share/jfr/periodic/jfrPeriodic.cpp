@@ -38,6 +38,7 @@
 #include "gc/shared/objectCountEventSender.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jfr/periodic/jfrModuleEvent.hpp"
+#include "jfr/periodic/jfrNativeMemoryEvent.hpp"
 #include "jfr/periodic/jfrOSInterface.hpp"
 #include "jfr/periodic/jfrThreadCPULoadEvent.hpp"
 #include "jfr/periodic/jfrThreadDumpEvent.hpp"
@@ -55,6 +56,7 @@
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/mutexLocker.hpp"
 #include "runtime/os.hpp"
 #include "runtime/os_perf.hpp"
 #include "runtime/thread.inline.hpp"
@@ -462,6 +464,14 @@ TRACE_REQUEST_FUNC(PhysicalMemory) {
   event.commit();
 }
 
+TRACE_REQUEST_FUNC(NativeMemoryUsage) {
+  JfrNativeMemoryEvent::send_type_events();
+}
+
+TRACE_REQUEST_FUNC(NativeMemoryUsageTotal) {
+  JfrNativeMemoryEvent::send_total_event();
+}
+
 TRACE_REQUEST_FUNC(JavaThreadStatistics) {
   EventJavaThreadStatistics event;
   event.set_activeCount(ThreadService::get_live_thread_count());
@@ -578,6 +588,28 @@ TRACE_REQUEST_FUNC(CompilerStatistics) {
   event.commit();
 }
 
+static void emit_compiler_queue_utilization(CompileQueue* queue) {
+  if (queue == NULL) {
+    return;
+  }
+  EventCompilerQueueUtilization event;
+  {
+    MutexLocker ml(MethodCompileQueue_lock);
+    event.set_queue(queue->name());
+    event.set_queueSize(queue->size());
+    event.set_peakQueueSize(queue->peak_size());
+    event.set_totalAddedCount(queue->total_added());
+    event.set_totalRemovedCount(queue->total_removed());
+    event.set_totalStaleCount(queue->total_stale());
+  }
+  event.commit();
+}
+
+TRACE_REQUEST_FUNC(CompilerQueueUtilization) {
+  emit_compiler_queue_utilization(CompileBroker::c1_compile_queue());
+  emit_compiler_queue_utilization(CompileBroker::c2_compile_queue());
+}
+
 TRACE_REQUEST_FUNC(CompilerConfiguration) {
   EventCompilerConfiguration event;
   event.set_threadCount(CICompilerCount);
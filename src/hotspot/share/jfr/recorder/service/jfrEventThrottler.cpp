@@ -27,6 +27,7 @@
 #include "jfr/recorder/service/jfrEventThrottler.hpp"
 #include "jfr/utilities/jfrSpinlockHelper.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
 
 constexpr static const JfrSamplerParams _disabled_params = {
                                                              0, // sample points per window
@@ -35,7 +36,20 @@ constexpr static const JfrSamplerParams _disabled_params = {
                                                              false // reconfigure
                                                            };
 
-static JfrEventThrottler* _throttler = NULL;
+// If the throttler is off, it accepts all events.
+constexpr static const int64_t event_throttler_off = -2;
+
+inline bool is_disabled(int64_t event_sample_size) {
+  return event_sample_size == event_throttler_off;
+}
+
+// One throttler per event type, created when the event is first configured.
+// The jdk.ObjectAllocationSample throttler is created eagerly at startup.
+static JfrEventThrottler* _throttlers[NUMBER_OF_EVENTS] = { NULL };
+
+static bool is_valid(JfrEventId event_id) {
+  return (unsigned)event_id >= FIRST_EVENT_ID && (unsigned)event_id <= LAST_EVENT_ID;
+}
 
 JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   JfrAdaptiveSampler(),
@@ -47,31 +61,60 @@ JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   _disabled(false),
   _update(false) {}
 
+JfrEventThrottler* JfrEventThrottler::create_throttler(JfrEventId event_id) {
+  JfrEventThrottler* const throttler = new JfrEventThrottler(event_id);
+  if (throttler == NULL || !throttler->initialize()) {
+    delete throttler;
+    return NULL;
+  }
+  return throttler;
+}
+
 bool JfrEventThrottler::create() {
-  assert(_throttler == NULL, "invariant");
-  _throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
-  return _throttler != NULL && _throttler->initialize();
+  assert(_throttlers[JfrObjectAllocationSampleEvent] == NULL, "invariant");
+  _throttlers[JfrObjectAllocationSampleEvent] = create_throttler(JfrObjectAllocationSampleEvent);
+  return _throttlers[JfrObjectAllocationSampleEvent] != NULL;
 }
 
 void JfrEventThrottler::destroy() {
-  delete _throttler;
-  _throttler = NULL;
+  for (int i = 0; i < NUMBER_OF_EVENTS; ++i) {
+    delete _throttlers[i];
+    _throttlers[i] = NULL;
+  }
 }
 
-// There is currently only one throttler instance, for the jdk.ObjectAllocationSample event.
-// When introducing additional throttlers, also add a lookup map keyed by event id.
+// Returns NULL if the event type has not been configured for throttling,
+// in which case all events are accepted.
 JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
-  assert(_throttler != NULL, "JfrEventThrottler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent, "Event type has an unconfigured throttler");
-  return event_id == JfrObjectAllocationSampleEvent ? _throttler : NULL;
+  assert(_throttlers[JfrObjectAllocationSampleEvent] != NULL, "JfrEventThrottler has not been properly initialized");
+  return is_valid(event_id) ? Atomic::load_acquire(&_throttlers[event_id]) : NULL;
 }
 
 void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int64_t period_ms) {
-  if (event_id != JfrObjectAllocationSampleEvent) {
+  if (!is_valid(event_id)) {
     return;
   }
-  assert(_throttler != NULL, "JfrEventThrottler has not been properly initialized");
-  _throttler->configure(sample_size, period_ms);
+  assert(_throttlers[JfrObjectAllocationSampleEvent] != NULL, "JfrEventThrottler has not been properly initialized");
+  JfrEventThrottler* throttler = Atomic::load_acquire(&_throttlers[event_id]);
+  if (throttler == NULL) {
+    if (is_disabled(sample_size)) {
+      // Nothing to turn off.
+      return;
+    }
+    JfrEventThrottler* const created = create_throttler(event_id);
+    if (created == NULL) {
+      log_warning(jfr, system, throttle)("Unable to create throttler for event id %u", (unsigned)event_id);
+      return;
+    }
+    throttler = Atomic::cmpxchg(&_throttlers[event_id], (JfrEventThrottler*)NULL, created);
+    if (throttler == NULL) {
+      throttler = created;
+    } else {
+      // Lost the race against a concurrent configuration of the same event type.
+      delete created;
+    }
+  }
+  throttler->configure(sample_size, period_ms);
 }
 
 /*
@@ -94,7 +137,7 @@ void JfrEventThrottler::configure(int64_t sample_size, int64_t period_ms) {
 bool JfrEventThrottler::accept(JfrEventId event_id, int64_t timestamp /* 0 */) {
   JfrEventThrottler* const throttler = for_event(event_id);
   if (throttler == NULL) return true;
-  return _throttler->_disabled ? true : _throttler->sample(timestamp);
+  return throttler->_disabled ? true : throttler->sample(timestamp);
 }
 
 /*
@@ -136,8 +179,6 @@ inline void set_low_rate(JfrSamplerParams& params, int64_t event_sample_size, in
   params.window_duration_ms = period_ms;
 }
 
-// If the throttler is off, it accepts all events.
-constexpr static const int64_t event_throttler_off = -2;
 
 /*
  * Set the number of sample points and window duration.
@@ -193,10 +234,6 @@ inline void normalize(int64_t* sample_size, int64_t* period_ms) {
   }
 }
 
-inline bool is_disabled(int64_t event_sample_size) {
-  return event_sample_size == event_throttler_off;
-}
-
 const JfrSamplerParams& JfrEventThrottler::update_params(const JfrSamplerWindow* expired) {
   _disabled = is_disabled(_sample_size);
   if (_disabled) {
@@ -236,20 +273,17 @@ inline double compute_ewma_alpha_coefficient(size_t lookback_count) {
  *
  * Excerpt:
  *
- * "jdk.ObjectAllocationSample: avg.sample size: 19.8377, window set point: 20 ..."
+ * "Event id <id>: avg.sample size: 19.8377, window set point: 20 ..."
  *
  * Monitoring the relation of average sample size to the window set point, i.e the target,
  * is a good indicator of how the throttler is performing over time.
- *
- * Note: there is currently only one throttler instance, for the ObjectAllocationSample event.
- * When introducing additional throttlers, also provide a map from the event id to the event name.
  */
-static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
+static void log(JfrEventId event_id, const JfrSamplerWindow* expired, double* sample_size_ewma) {
   assert(sample_size_ewma != NULL, "invariant");
   if (log_is_enabled(Debug, jfr, system, throttle)) {
     *sample_size_ewma = exponentially_weighted_moving_average(expired->sample_size(), compute_ewma_alpha_coefficient(expired->params().window_lookback_count), *sample_size_ewma);
-    log_debug(jfr, system, throttle)("jdk.ObjectAllocationSample: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
-      *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
+    log_debug(jfr, system, throttle)("Event id %u: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+      (unsigned)event_id, *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
       expired->population_size() == 0 ? 0 : (double)expired->sample_size() / (double)expired->population_size(),
       expired->params().window_duration_ms);
   }
@@ -268,7 +302,7 @@ static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
 const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWindow* expired) {
   assert(expired != NULL, "invariant");
   assert(_lock, "invariant");
-  log(expired, &_sample_size_ewma);
+  log(_event_id, expired, &_sample_size_ewma);
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
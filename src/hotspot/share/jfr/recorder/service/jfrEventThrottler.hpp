@@ -42,6 +42,7 @@ class JfrEventThrottler : public JfrAdaptiveSampler {
 
   static bool create();
   static void destroy();
+  static JfrEventThrottler* create_throttler(JfrEventId event_id);
   JfrEventThrottler(JfrEventId event_id);
   void configure(int64_t event_sample_size, int64_t period_ms);
 
@@ -27,6 +27,7 @@
 #include "logging/logFileOutput.hpp"
 #include "logging/logHandle.hpp"
 #include "runtime/atomic.hpp"
+#include "utilities/growableArray.hpp"
 
 class AsyncLogWriter::AsyncLogLocker : public StackObj {
  public:
@@ -40,27 +41,40 @@ class AsyncLogWriter::AsyncLogLocker : public StackObj {
   }
 };
 
-void AsyncLogWriter::enqueue_locked(const AsyncLogMessage& msg) {
-  if (_buffer.size() >= _buffer_max_size)  {
+AsyncLogWriter::Buffer::Buffer(size_t capacity) : _pos(0), _capacity(capacity) {
+  _buf = NEW_C_HEAP_ARRAY(char, capacity, mtLogging);
+  assert(is_aligned(_buf, alignof(Message)), "must be");
+}
+
+AsyncLogWriter::Buffer::~Buffer() {
+  FREE_C_HEAP_ARRAY(char, _buf);
+}
+
+bool AsyncLogWriter::Buffer::push_back(LogFileOutput* output, const LogDecorations& decorations, const char* msg) {
+  const size_t sz = Message::calc_size(strlen(msg));
+  if (_pos + sz > _capacity) {
+    return false;
+  }
+  new (_buf + _pos) Message(output, decorations, msg);
+  _pos += sz;
+  return true;
+}
+
+void AsyncLogWriter::enqueue_locked(LogFileOutput* output, const LogDecorations& decorations, const char* msg) {
+  if (!_buffer->push_back(output, decorations, msg)) {
     bool p_created;
-    uint32_t* counter = _stats.add_if_absent(msg.output(), 0, &p_created);
+    uint32_t* counter = _stats.add_if_absent(output, 0, &p_created);
     *counter = *counter + 1;
     // drop the enqueueing message.
     return;
   }
 
-  assert(_buffer.size() < _buffer_max_size, "_buffer is over-sized.");
-  _buffer.push_back(msg);
   _sem.signal();
 }
 
 void AsyncLogWriter::enqueue(LogFileOutput& output, const LogDecorations& decorations, const char* msg) {
-  AsyncLogMessage m(output, decorations, os::strdup(msg));
-
-  { // critical area
-    AsyncLogLocker locker;
-    enqueue_locked(m);
-  }
+  AsyncLogLocker locker;
+  enqueue_locked(&output, decorations, msg);
 }
 
 // LogMessageBuffer consists of a multiple-part/multiple-line messsage.
@@ -69,8 +83,7 @@ void AsyncLogWriter::enqueue(LogFileOutput& output, LogMessageBuffer::Iterator m
   AsyncLogLocker locker;
 
   for (; !msg_iterator.is_at_end(); msg_iterator++) {
-    AsyncLogMessage m(output, msg_iterator.decorations(), os::strdup(msg_iterator.message()));
-    enqueue_locked(m);
+    enqueue_locked(&output, msg_iterator.decorations(), msg_iterator.message());
   }
 }
 
@@ -78,30 +91,33 @@ AsyncLogWriter::AsyncLogWriter()
   : _lock(1), _sem(0), _io_sem(1),
     _initialized(false),
     _stats(17 /*table_size*/) {
+  size_t size = AsyncLogBufferSize / 2;
+  _buffer = new Buffer(size);
+  _buffer_staging = new Buffer(size);
+
   if (os::create_thread(this, os::asynclog_thread)) {
     _initialized = true;
   } else {
     log_warning(logging, thread)("AsyncLogging failed to create thread. Falling back to synchronous logging.");
   }
 
-  log_info(logging)("The maximum entries of AsyncLogBuffer: " SIZE_FORMAT ", estimated memory use: " SIZE_FORMAT " bytes",
-                    _buffer_max_size, AsyncLogBufferSize);
+  log_info(logging)("AsyncLogBuffer estimates memory use: " SIZE_FORMAT " bytes", AsyncLogBufferSize);
 }
 
+struct AsyncLogDroppedCount {
+  LogFileOutput* _output;
+  uint32_t _count;
+};
+
 class AsyncLogMapIterator {
-  AsyncLogBuffer& _logs;
+  GrowableArray<AsyncLogDroppedCount>& _dropped;
 
  public:
-  AsyncLogMapIterator(AsyncLogBuffer& logs) :_logs(logs) {}
+  AsyncLogMapIterator(GrowableArray<AsyncLogDroppedCount>& dropped) : _dropped(dropped) {}
   bool do_entry(LogFileOutput* output, uint32_t* counter) {
-    using none = LogTagSetMapping<LogTag::__NO_TAG>;
-
     if (*counter > 0) {
-      LogDecorations decorations(LogLevel::Warning, none::tagset(), output->decorators());
-      stringStream ss;
-      ss.print(UINT32_FORMAT_W(6) " messages dropped due to async logging", *counter);
-      AsyncLogMessage msg(*output, decorations, ss.as_string(true /*c_heap*/));
-      _logs.push_back(msg);
+      AsyncLogDroppedCount dc = { output, *counter };
+      _dropped.append(dc);
       *counter = 0;
     }
 
@@ -109,39 +125,47 @@ class AsyncLogMapIterator {
   }
 };
 
+// Requires _io_sem to be held.
+void AsyncLogWriter::write_messages(Buffer* buffer) {
+  Buffer::Iterator it = buffer->iterator();
+  while (it.has_next()) {
+    const Message* e = it.next();
+    e->output()->write_blocking(e->decorations(), e->message());
+  }
+  buffer->reset();
+}
+
 void AsyncLogWriter::write() {
   // Use kind of copy-and-swap idiom here.
-  // Empty 'logs' swaps the content with _buffer.
-  // Along with logs destruction, all processed messages are deleted.
+  // Under the lock, the pending messages in _buffer are swapped with the
+  // empty _buffer_staging. All I/O jobs are then performed without lock
+  // protection. This guarantees I/O jobs don't block logsites.
   //
-  // The operation 'pop_all()' is done in O(1). All I/O jobs are then performed without
-  // lock protection. This guarantees I/O jobs don't block logsites.
-  AsyncLogBuffer logs;
-  bool own_io = false;
+  // _buffer_staging belongs to the holder of _io_sem, so concurrent callers
+  // of write() (the AsyncLog Thread and flush()) take turns. Taking _io_sem
+  // before the swap keeps the messages in order.
+  ResourceMark rm;
+  GrowableArray<AsyncLogDroppedCount> dropped;
 
+  _io_sem.wait();
   { // critical region
     AsyncLogLocker locker;
 
-    _buffer.pop_all(&logs);
-    // append meta-messages of dropped counters
-    AsyncLogMapIterator dropped_counters_iter(logs);
+    swap(_buffer, _buffer_staging);
+    // collect dropped counters, reported after the messages
+    AsyncLogMapIterator dropped_counters_iter(dropped);
     _stats.iterate(&dropped_counters_iter);
-    own_io = _io_sem.trywait();
-  }
-
-  LinkedListIterator<AsyncLogMessage> it(logs.head());
-  if (!own_io) {
-    _io_sem.wait();
   }
 
-  while (!it.is_empty()) {
-    AsyncLogMessage* e = it.next();
-    char* msg = e->message();
+  write_messages(_buffer_staging);
 
-    if (msg != nullptr) {
-      e->output()->write_blocking(e->decorations(), msg);
-      os::free(msg);
-    }
+  using none = LogTagSetMapping<LogTag::__NO_TAG>;
+  for (int i = 0; i < dropped.length(); i++) {
+    LogFileOutput* output = dropped.at(i)._output;
+    LogDecorations decorations(LogLevel::Warning, none::tagset(), output->decorators());
+    stringStream ss;
+    ss.print(UINT32_FORMAT_W(6) " messages dropped due to async logging", dropped.at(i)._count);
+    output->write_blocking(decorations, ss.as_string());
   }
   _io_sem.signal();
 }
@@ -187,3 +211,37 @@ void AsyncLogWriter::flush() {
     _instance->write();
   }
 }
+
+// Holding _io_sem guarantees that no write() is using _buffer_staging while
+// the buffers are replaced. Messages still pending in the replaced _buffer
+// are written out before returning.
+AsyncLogWriter::BufferUpdater::BufferUpdater(size_t capacity) {
+  assert(_instance != nullptr, "async logging is not established");
+  _instance->_io_sem.wait();
+  _saved_buffer_staging = _instance->_buffer_staging;
+  _instance->_buffer_staging = new Buffer(capacity);
+  {
+    AsyncLogLocker locker;
+    _saved_buffer = _instance->_buffer;
+    _instance->_buffer = new Buffer(capacity);
+  }
+  _instance->write_messages(_saved_buffer);
+  _instance->_io_sem.signal();
+}
+
+AsyncLogWriter::BufferUpdater::~BufferUpdater() {
+  AsyncLogWriter::flush();
+
+  _instance->_io_sem.wait();
+  Buffer* buffer;
+  {
+    AsyncLogLocker locker;
+    buffer = _instance->_buffer;
+    _instance->_buffer = _saved_buffer;
+  }
+  _instance->write_messages(buffer);
+  delete buffer;
+  delete _instance->_buffer_staging;
+  _instance->_buffer_staging = _saved_buffer_staging;
+  _instance->_io_sem.signal();
+}
@@ -30,84 +30,7 @@
 #include "memory/resourceArea.hpp"
 #include "runtime/nonJavaThread.hpp"
 #include "utilities/hashtable.hpp"
-#include "utilities/linkedlist.hpp"
 
-template <typename E, MEMFLAGS F>
-class LinkedListDeque : private LinkedListImpl<E, ResourceObj::C_HEAP, F> {
- private:
-  LinkedListNode<E>* _tail;
-  size_t _size;
-
- public:
-  LinkedListDeque() : _tail(NULL), _size(0) {}
-  void push_back(const E& e) {
-    if (!_tail) {
-      _tail = this->add(e);
-    } else {
-      _tail = this->insert_after(e, _tail);
-    }
-
-    ++_size;
-  }
-
-  // pop all elements to logs.
-  void pop_all(LinkedList<E>* logs) {
-    logs->move(static_cast<LinkedList<E>* >(this));
-    _tail = NULL;
-    _size = 0;
-  }
-
-  void pop_all(LinkedListDeque<E, F>* logs) {
-    logs->_size = _size;
-    logs->_tail = _tail;
-    pop_all(static_cast<LinkedList<E>* >(logs));
-  }
-
-  void pop_front() {
-    LinkedListNode<E>* h = this->unlink_head();
-    if (h == _tail) {
-      _tail = NULL;
-    }
-
-    if (h != NULL) {
-      --_size;
-      this->delete_node(h);
-    }
-  }
-
-  size_t size() const { return _size; }
-
-  const E* front() const {
-    return this->_head == NULL ? NULL : this->_head->peek();
-  }
-
-  const E* back() const {
-    return _tail == NULL ? NULL : _tail->peek();
-  }
-
-  LinkedListNode<E>* head() const {
-    return this->_head;
-  }
-};
-
-class AsyncLogMessage {
-  LogFileOutput& _output;
-  const LogDecorations _decorations;
-  char* _message;
-
-public:
-  AsyncLogMessage(LogFileOutput& output, const LogDecorations& decorations, char* msg)
-    : _output(output), _decorations(decorations), _message(msg) {}
-
-  // placeholder for LinkedListImpl.
-  bool equals(const AsyncLogMessage& o) const { return false; }
-
-  LogFileOutput* output() const { return &_output; }
-  const LogDecorations& decorations() const { return _decorations; }
-  char* message() const { return _message; }
-};
-
-typedef LinkedListDeque<AsyncLogMessage, mtLogging> AsyncLogBuffer;
 typedef KVHashtable<LogFileOutput*, uint32_t, mtLogging> AsyncLogMap;
 
 //
@@ -135,6 +58,65 @@ typedef KVHashtable<LogFileOutput*, uint32_t, mtLogging> AsyncLogMap;
 class AsyncLogWriter : public NonJavaThread {
   class AsyncLogLocker;
 
+  // A message is stored in a Buffer as a header followed by its c-str payload.
+  class Message {
+    LogFileOutput* const _output;
+    const LogDecorations _decorations;
+
+   public:
+    Message(LogFileOutput* output, const LogDecorations& decorations, const char* msg)
+      : _output(output), _decorations(decorations) {
+      strcpy(message(), msg);
+    }
+
+    // Size of a Message with a payload of msg_len characters, including the
+    // terminator and padding to keep the next Message aligned.
+    static constexpr size_t calc_size(size_t msg_len) {
+      return align_up(sizeof(Message) + msg_len + 1, alignof(Message));
+    }
+
+    size_t size() const { return calc_size(strlen(message())); }
+    LogFileOutput* output() const { return _output; }
+    const LogDecorations& decorations() const { return _decorations; }
+    char* message() const { return (char*)(this + 1); }
+  };
+
+  // A contiguous, preallocated area that Messages are copied into. Enqueueing
+  // a message is a single copy; nothing is allocated per message.
+  class Buffer : public CHeapObj<mtLogging> {
+    char* _buf;
+    size_t _pos;
+    const size_t _capacity;
+
+   public:
+    class Iterator {
+      const Buffer& _buffer;
+      size_t _curr;
+
+     public:
+      Iterator(const Buffer& buffer) : _buffer(buffer), _curr(0) {}
+
+      bool has_next() const { return _curr < _buffer._pos; }
+
+      const Message* next() {
+        assert(has_next(), "must be");
+        Message* msg = (Message*)(_buffer._buf + _curr);
+        _curr += msg->size();
+        return msg;
+      }
+    };
+
+    Buffer(size_t capacity);
+    ~Buffer();
+
+    // Returns false, without copying anything, if the message does not fit.
+    bool push_back(LogFileOutput* output, const LogDecorations& decorations, const char* msg);
+    void reset() { _pos = 0; }
+    bool is_empty() const { return _pos == 0; }
+    size_t capacity() const { return _capacity; }
+    Iterator iterator() const { return Iterator(*this); }
+  };
+
   static AsyncLogWriter* _instance;
   // _lock(1) denotes a critional region.
   Semaphore _lock;
@@ -145,15 +127,16 @@ class AsyncLogWriter : public NonJavaThread {
   Semaphore _io_sem;
 
   volatile bool _initialized;
-  AsyncLogMap _stats; // statistics for dropped messages
-  AsyncLogBuffer _buffer;
-
-  // The memory use of each AsyncLogMessage (payload) consists of itself and a variable-length c-str message.
-  // A regular logging message is smaller than vwrite_buffer_size, which is defined in logtagset.cpp
-  const size_t _buffer_max_size = {AsyncLogBufferSize / (sizeof(AsyncLogMessage) + vwrite_buffer_size)};
+  AsyncLogMap _stats; // statistics for dropped messages, protected by _lock
+  // Producers append to _buffer under _lock. The writer swaps it with
+  // _buffer_staging, which is only accessed while holding _io_sem, and
+  // performs the I/O from there. Each takes half of AsyncLogBufferSize.
+  Buffer* _buffer;
+  Buffer* _buffer_staging;
 
   AsyncLogWriter();
-  void enqueue_locked(const AsyncLogMessage& msg);
+  void enqueue_locked(LogFileOutput* output, const LogDecorations& decorations, const char* msg);
+  void write_messages(Buffer* buffer);
   void write();
   void run() override;
   void pre_run() override {
@@ -174,6 +157,16 @@ class AsyncLogWriter : public NonJavaThread {
   static AsyncLogWriter* instance();
   static void initialize();
   static void flush();
+
+  // Temporarily replaces the buffers with buffers of the given capacity. For testing only.
+  class BufferUpdater : public StackObj {
+    Buffer* _saved_buffer;
+    Buffer* _saved_buffer_staging;
+
+   public:
+    BufferUpdater(size_t capacity);
+    ~BufferUpdater();
+  };
 };
 
 #endif // SHARE_LOGGING_LOGASYNCWRITER_HPP
@@ -40,6 +40,7 @@ const char* const LogFileOutput::TimestampFilenamePlaceholder = "%t";
 const char* const LogFileOutput::TimestampFormat = "%Y-%m-%d_%H-%M-%S";
 const char* const LogFileOutput::FileSizeOptionKey = "filesize";
 const char* const LogFileOutput::FileCountOptionKey = "filecount";
+const char* const LogFileOutput::FormatOptionKey = "format";
 char        LogFileOutput::_pid_str[PidBufferSize];
 char        LogFileOutput::_vm_start_time_str[StartTimeBufferSize];
 
@@ -110,15 +111,6 @@ static bool is_regular_file(const char* filename) {
   return (st.st_mode & S_IFMT) == S_IFREG;
 }
 
-static bool is_fifo_file(const char* filename) {
-  struct stat st;
-  int ret = os::stat(filename, &st);
-  if (ret != 0) {
-    return false;
-  }
-  return S_ISFIFO(st.st_mode);
-}
-
 // Try to find the next number that should be used for file rotation.
 // Return UINT_MAX on error.
 static uint next_file_number(const char* filename,
@@ -216,6 +208,16 @@ bool LogFileOutput::parse_options(const char* options, outputStream* errstream)
         break;
       }
       _rotate_size = static_cast<size_t>(value);
+    } else if (strcmp(FormatOptionKey, key) == 0) {
+      if (strcmp(value_str, "text") == 0) {
+        _json = false;
+      } else if (strcmp(value_str, "json") == 0) {
+        _json = true;
+      } else {
+        errstream->print_cr("Invalid option: %s must be 'text' or 'json'", FormatOptionKey);
+        success = false;
+        break;
+      }
     } else {
       errstream->print_cr("Invalid option '%s' for log file output.", key);
       success = false;
@@ -234,7 +236,7 @@ bool LogFileOutput::initialize(const char* options, outputStream* errstream) {
   }
 
   bool file_exist = file_exists(_file_name);
-  if (file_exist && _is_default_file_count && is_fifo_file(_file_name)) {
+  if (file_exist && _is_default_file_count && os::is_fifo(_file_name)) {
     _file_count = 0; // Prevent file rotation for fifo's such as named pipes.
   }
 
@@ -493,8 +495,9 @@ void LogFileOutput::describe(outputStream *out) {
   LogOutput::describe(out);
   out->print(" ");
 
-  out->print("filecount=%u,filesize=" SIZE_FORMAT "%s,async=%s", _file_count,
+  out->print("filecount=%u,filesize=" SIZE_FORMAT "%s,format=%s,async=%s", _file_count,
              byte_size_in_proper_unit(_rotate_size),
              proper_unit_for_byte_size(_rotate_size),
+             _json ? "json" : "text",
              LogConfiguration::is_async_mode() ? "true" : "false");
 }
@@ -74,6 +74,135 @@ int LogFileStreamOutput::write_decorations(const LogDecorations& decorations) {
   return total_written;
 }
 
+// Returns the length of the well-formed UTF-8 sequence of more than one byte
+// starting at s, or 0 if there is none.
+static size_t utf8_sequence_length(const unsigned char* s) {
+  size_t len;
+  uint32_t code_point;
+  if (s[0] >= 0xC2 && s[0] <= 0xDF) {
+    len = 2;
+    code_point = s[0] & 0x1F;
+  } else if ((s[0] & 0xF0) == 0xE0) {
+    len = 3;
+    code_point = s[0] & 0x0F;
+  } else if (s[0] >= 0xF0 && s[0] <= 0xF4) {
+    len = 4;
+    code_point = s[0] & 0x07;
+  } else {
+    return 0;
+  }
+  for (size_t i = 1; i < len; i++) {
+    // Also stops at the terminating NUL.
+    if ((s[i] & 0xC0) != 0x80) {
+      return 0;
+    }
+    code_point = (code_point << 6) | (s[i] & 0x3F);
+  }
+  // Reject overlong encodings, surrogates and code points beyond U+10FFFF.
+  if ((len == 3 && code_point < 0x800) ||
+      (len == 4 && code_point < 0x10000) ||
+      (code_point >= 0xD800 && code_point <= 0xDFFF) ||
+      code_point > 0x10FFFF) {
+    return 0;
+  }
+  return len;
+}
+
+// Writes the given string as a quoted JSON string. Quotes and backslashes are
+// escaped, \n and \t as such and other control characters as \u00XX.
+// Well-formed UTF-8 sequences are copied unchanged. Every other byte at or
+// above 0x80 is written as \u00XX, i.e. as if it was a Latin-1 character, so
+// the result is always valid JSON.
+int LogFileStreamOutput::write_json_string(const char* str) {
+  if (fputc('"', _stream) == EOF) {
+    return -1;
+  }
+  int total_written = 1;
+  const char* run = str;
+  for (const char* p = str; ; p++) {
+    const unsigned char c = static_cast<unsigned char>(*p);
+    if (c >= 0x80) {
+      size_t seq_len = utf8_sequence_length(reinterpret_cast<const unsigned char*>(p));
+      if (seq_len > 0) {
+        p += seq_len - 1;
+        continue;
+      }
+    } else if (c != '\0' && c != '"' && c != '\\' && c >= 0x20) {
+      continue;
+    }
+    const size_t run_len = p - run;
+    if (run_len > 0) {
+      if (fwrite(run, 1, run_len, _stream) != run_len) {
+        return -1;
+      }
+      total_written += static_cast<int>(run_len);
+    }
+    if (c == '\0') {
+      break;
+    }
+    int written;
+    switch (c) {
+      case '"':  written = jio_fprintf(_stream, "\\\""); break;
+      case '\\': written = jio_fprintf(_stream, "\\\\"); break;
+      case '\n': written = jio_fprintf(_stream, "\\n"); break;
+      case '\t': written = jio_fprintf(_stream, "\\t"); break;
+      default:   written = jio_fprintf(_stream, "\\u%04x", c); break;
+    }
+    if (written <= 0) {
+      return -1;
+    }
+    total_written += written;
+    run = p + 1;
+  }
+  if (fputc('"', _stream) == EOF) {
+    return -1;
+  }
+  return total_written + 1;
+}
+
+// Writes one line of the form {"<decorator>":"<decoration>",...,"message":"<msg>"}.
+// Decorator paddings are not applied as the fields are keyed by name.
+int LogFileStreamOutput::write_json(const LogDecorations& decorations, const char* msg) {
+  int total_written = 0;
+  char buf[LogDecorations::max_decoration_size + 1];
+
+  if (fputc('{', _stream) == EOF) {
+    return -1;
+  }
+  total_written++;
+  for (uint i = 0; i < LogDecorators::Count; i++) {
+    LogDecorators::Decorator decorator = static_cast<LogDecorators::Decorator>(i);
+    if (!_decorators.is_decorator(decorator)) {
+      continue;
+    }
+    int written = jio_fprintf(_stream, "\"%s\":", LogDecorators::name(decorator));
+    if (written <= 0) {
+      return -1;
+    }
+    total_written += written;
+    written = write_json_string(decorations.decoration(decorator, buf, sizeof(buf)));
+    if (written < 0 || fputc(',', _stream) == EOF) {
+      return -1;
+    }
+    total_written += written + 1;
+  }
+  int written = jio_fprintf(_stream, "\"message\":");
+  if (written <= 0) {
+    return -1;
+  }
+  total_written += written;
+  written = write_json_string(msg);
+  if (written < 0) {
+    return -1;
+  }
+  total_written += written;
+  written = jio_fprintf(_stream, "}\n");
+  if (written <= 0) {
+    return -1;
+  }
+  return total_written + written;
+}
+
 class FileLocker : public StackObj {
 private:
   FILE *_file;
@@ -122,6 +251,10 @@ int LogFileStreamOutput::write(const LogDecorations& decorations, const char* ms
 
   int written = 0;
   FileLocker flocker(_stream);
+  if (_json) {
+    WRITE_LOG_WITH_RESULT_CHECK(write_json(decorations, msg), written);
+    return flush() ? written : -1;
+  }
   if (use_decorations) {
     WRITE_LOG_WITH_RESULT_CHECK(write_decorations(decorations), written);
     WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, " "), written);
@@ -137,6 +270,10 @@ int LogFileStreamOutput::write(LogMessageBuffer::Iterator msg_iterator) {
   int written = 0;
   FileLocker flocker(_stream);
   for (; !msg_iterator.is_at_end(); msg_iterator++) {
+    if (_json) {
+      WRITE_LOG_WITH_RESULT_CHECK(write_json(msg_iterator.decorations(), msg_iterator.message()), written);
+      continue;
+    }
     if (use_decorations) {
       WRITE_LOG_WITH_RESULT_CHECK(write_decorations(msg_iterator.decorations()), written);
       WRITE_LOG_WITH_RESULT_CHECK(jio_fprintf(_stream, " "), written);
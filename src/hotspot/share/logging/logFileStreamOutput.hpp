@@ -45,14 +45,18 @@ class LogFileStreamOutput : public LogOutput {
  protected:
   FILE*               _stream;
   size_t              _decorator_padding[LogDecorators::Count];
+  // Write every message as a single-line JSON object instead of plain text.
+  bool                _json;
 
-  LogFileStreamOutput(FILE *stream) : _write_error_is_shown(false), _stream(stream) {
+  LogFileStreamOutput(FILE *stream) : _write_error_is_shown(false), _stream(stream), _json(false) {
     for (size_t i = 0; i < LogDecorators::Count; i++) {
       _decorator_padding[i] = 0;
     }
   }
 
   int write_decorations(const LogDecorations& decorations);
+  int write_json_string(const char* str);
+  int write_json(const LogDecorations& decorations, const char* msg);
   bool flush();
 
  public:
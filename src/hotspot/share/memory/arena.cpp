@@ -23,6 +23,7 @@
  */
 
 #include "precompiled.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
@@ -92,8 +93,9 @@ class ChunkPool: public CHeapObj<mtInternal> {
     _num_chunks++;
   }
 
-  // Prune the pool
-  void free_all_but(size_t n) {
+  // Prune the pool, returns the number of bytes freed
+  size_t free_all_but(size_t n) {
+    size_t freed = 0;
     Chunk* cur = NULL;
     Chunk* next;
     {
@@ -115,11 +117,13 @@ class ChunkPool: public CHeapObj<mtInternal> {
             next = cur->next();
             os::free(cur);
             _num_chunks--;
+            freed += _size;
             cur = next;
           }
         }
       }
     }
+    return freed;
   }
 
   // Accessors to preallocated pool's
@@ -135,12 +139,15 @@ class ChunkPool: public CHeapObj<mtInternal> {
     _tiny_pool   = new ChunkPool(Chunk::tiny_size   + Chunk::aligned_overhead_size());
   }
 
-  static void clean() {
+  // Returns the number of bytes freed
+  static size_t clean() {
     enum { BlocksToKeep = 5 };
-     _tiny_pool->free_all_but(BlocksToKeep);
-     _small_pool->free_all_but(BlocksToKeep);
-     _medium_pool->free_all_but(BlocksToKeep);
-     _large_pool->free_all_but(BlocksToKeep);
+    size_t freed = 0;
+    freed += _tiny_pool->free_all_but(BlocksToKeep);
+    freed += _small_pool->free_all_but(BlocksToKeep);
+    freed += _medium_pool->free_all_but(BlocksToKeep);
+    freed += _large_pool->free_all_but(BlocksToKeep);
+    return freed;
   }
 };
 
@@ -161,10 +168,20 @@ void chunkpool_init() {
 class ChunkPoolCleaner : public PeriodicTask {
   enum { CleaningInterval = 5000 };      // cleaning interval in ms
 
+  // Minimum number of bytes freed by a cleaning to trim the C-heap after it.
+  static const size_t TrimThreshold = 4 * M;
+
  public:
    ChunkPoolCleaner() : PeriodicTask(CleaningInterval) {}
    void task() {
-     ChunkPool::clean();
+     size_t freed = ChunkPool::clean();
+     // After a burst of arena usage (e.g. large compilations) the chunks freed
+     // above typically stay resident in the C-heap; trimming gives them back.
+     if (TrimNativeHeapAfterChunkPoolClean && freed >= TrimThreshold) {
+       bool trimmed = os::trim_native_heap();
+       log_debug(os)("Chunk pool cleaning freed " SIZE_FORMAT "K, C-heap %s",
+                     freed / K, trimmed ? "trimmed" : "not trimmed (unsupported)");
+     }
    }
 };
 
@@ -53,6 +53,26 @@ namespace metaspace {
 #define LOGFMT         "VsListNode @" PTR_FORMAT " base " PTR_FORMAT " "
 #define LOGFMT_ARGS    p2i(this), p2i(_base)
 
+// Page size hint used when committing memory. If the platform can back
+// committed memory with large pages (e.g. transparent huge pages on Linux), the
+// large page size is passed down as alignment hint, which makes the os layer
+// advise the kernel to use large pages for the range.
+static size_t commit_alignment_hint() {
+  return os::can_commit_large_page_memory() ? os::large_page_size() : os::vm_page_size();
+}
+
+// Report the page size the node was reserved with. Whether the kernel honors
+// the large page hint for committed ranges is not known to us, so log the hint
+// separately instead of passing it off as the page size in use.
+static void trace_node_page_sizes(const ReservedSpace& rs) {
+  os::trace_page_sizes("Metaspace node", rs.size(), rs.size(), rs.page_size(), rs.base(), rs.size());
+  const size_t hint = commit_alignment_hint();
+  if (hint != rs.page_size()) {
+    log_info(pagesize)("Metaspace node: base=" PTR_FORMAT " commit alignment hint=" SIZE_FORMAT "%s (large pages advised, not guaranteed)",
+                       p2i(rs.base()), byte_size_in_exact_unit(hint), exact_unit_for_byte_size(hint));
+  }
+}
+
 #ifdef ASSERT
 void check_pointer_is_aligned_to_commit_granule(const MetaWord* p) {
   assert(is_aligned(p, Settings::commit_granule_bytes()),
@@ -106,7 +126,7 @@ bool VirtualSpaceNode::commit_range(MetaWord* p, size_t word_size) {
   }
 
   // Commit...
-  if (os::commit_memory((char*)p, word_size * BytesPerWord, false) == false) {
+  if (os::commit_memory((char*)p, word_size * BytesPerWord, commit_alignment_hint(), false) == false) {
     vm_exit_out_of_memory(word_size * BytesPerWord, OOM_MMAP_ERROR, "Failed to commit metaspace.");
   }
 
@@ -250,6 +270,7 @@ VirtualSpaceNode* VirtualSpaceNode::create_node(size_t word_size,
   }
   MemTracker::record_virtual_memory_type(rs.base(), mtMetaspace);
   assert_is_aligned(rs.base(), chunklevel::MAX_CHUNK_BYTE_SIZE);
+  trace_node_page_sizes(rs);
   InternalStats::inc_num_vsnodes_births();
   return new VirtualSpaceNode(rs, true, limiter, reserve_words_counter, commit_words_counter);
 }
@@ -258,6 +279,7 @@ VirtualSpaceNode* VirtualSpaceNode::create_node(size_t word_size,
 VirtualSpaceNode* VirtualSpaceNode::create_node(ReservedSpace rs, CommitLimiter* limiter,
                                                 SizeCounter* reserve_words_counter, SizeCounter* commit_words_counter)
 {
+  trace_node_page_sizes(rs);
   InternalStats::inc_num_vsnodes_births();
   return new VirtualSpaceNode(rs, false, limiter, reserve_words_counter, commit_words_counter);
 }
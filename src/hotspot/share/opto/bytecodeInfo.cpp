@@ -655,7 +655,7 @@ InlineTree *InlineTree::build_inline_tree_root() {
   Compile* C = Compile::current();
 
   // Root of inline tree
-  InlineTree* ilt = new InlineTree(C, NULL, C->method(), NULL, -1, MaxInlineLevel);
+  InlineTree* ilt = new InlineTree(C, NULL, C->method(), NULL, -1, C->directive()->MaxInlineLevelOption);
 
   return ilt;
 }
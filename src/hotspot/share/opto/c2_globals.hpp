@@ -360,6 +360,12 @@
           "Limit of ops to make speculative when using CMOVE")              \
           range(0, max_jint)                                                \
                                                                             \
+  product(intx, UnpredictableBranchCMovePercent, 0, EXPERIMENTAL,           \
+          "Use twice the ConditionalMoveLimit for branches that are "       \
+          "profiled to go either way at least this % of the time. "         \
+          "0 disables it")                                                  \
+          range(0, 50)                                                      \
+                                                                            \
   notproduct(bool, PrintIdealGraph, false,                                  \
           "Print ideal graph to XML file / network interface. "             \
           "By default attempts to connect to the visualizer on a socket.")  \
@@ -390,6 +396,16 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(intx, PolymorphicInlineLimit, 0, EXPERIMENTAL,                    \
+          "Inline up to this many profiled receivers behind a type switch " \
+          "at polymorphic call sites without a major receiver. At most "    \
+          "TypeProfileWidth receivers are profiled. 0 disables it")         \
+          range(0, 8)                                                       \
+                                                                            \
+  product(bool, UseClassInitRuntimeCall, false, EXPERIMENTAL,               \
+          "Initialize classes that are not yet initialized at compile time "\
+          "with a runtime call on first use instead of an uncommon trap")   \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -407,6 +423,12 @@
           "Set level of loop optimization for tier 1 compiles")             \
           range(5, 43)                                                      \
                                                                             \
+  product(uintx, OptimizeTimeBudget, 0, EXPERIMENTAL,                       \
+          "Time in milliseconds after which the optimizer skips escape "    \
+          "analysis and further loop optimization rounds of a method. "     \
+          "Ignored with ReplayCompiles, CompileCommands or compiler "       \
+          "directives. 0 means no limit")                                   \
+                                                                            \
   /* controls for heat-based inlining */                                    \
                                                                             \
   develop(intx, NodeCountInliningCutoff, 18000,                             \
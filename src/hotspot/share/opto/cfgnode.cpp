@@ -1884,6 +1884,98 @@ bool PhiNode::wait_for_region_igvn(PhaseGVN* phase) {
   return delay;
 }
 
+// Clone the graph of Phis rooted at root_phi, replacing every VectorBox input
+// with its input c (the box or the vector value). Returns the clone of root_phi.
+static Node* clone_through_phi(Node* root_phi, const Type* t, uint c, PhaseIterGVN* igvn) {
+  Node_Stack stack(1);
+  VectorSet  visited;
+  Node_List  node_map;
+
+  stack.push(root_phi, 1); // ignore control
+  visited.set(root_phi->_idx);
+
+  Node* new_root_phi = new PhiNode(root_phi->in(0), t);
+  node_map.map(root_phi->_idx, new_root_phi);
+
+  while (stack.is_nonempty()) {
+    Node* n   = stack.node();
+    uint  idx = stack.index();
+    assert(n->is_Phi(), "not a phi");
+    if (idx < n->req()) {
+      stack.set_index(idx + 1);
+      Node* def = n->in(idx);
+      if (def == NULL) {
+        continue; // ignore dead path
+      }
+      Node* new_phi = node_map[n->_idx];
+      if (def->is_Phi()) {
+        if (!visited.test_set(def->_idx)) {
+          node_map.map(def->_idx, new PhiNode(def->in(0), t));
+          stack.push(def, 1); // ignore control
+        }
+        new_phi->set_req(idx, node_map[def->_idx]);
+      } else {
+        assert(def->Opcode() == Op_VectorBox, "checked by merge_through_phi");
+        new_phi->set_req(idx, def->in(c));
+      }
+    } else {
+      igvn->register_new_node_with_optimizer(node_map[n->_idx], n);
+      stack.pop();
+    }
+  }
+  return new_root_phi;
+}
+
+// Phi (VB ... VB) => VB (Phi ...) (Phi ...)
+//
+// The inputs of root_phi may be Phis themselves, e.g. for vectors carried
+// around a loop back-edge. The transformation is done if all non-Phi inputs
+// reachable through Phis are VectorBoxes of the same type.
+static Node* merge_through_phi(Node* root_phi, PhaseIterGVN* igvn) {
+  Node_Stack stack(1);
+  VectorSet  visited;
+
+  stack.push(root_phi, 1); // ignore control
+  visited.set(root_phi->_idx);
+
+  VectorBoxNode* cached_vbox = NULL;
+  while (stack.is_nonempty()) {
+    Node* n   = stack.node();
+    uint  idx = stack.index();
+    if (idx < n->req()) {
+      stack.set_index(idx + 1);
+      Node* in = n->in(idx);
+      if (in == NULL) {
+        continue; // ignore dead path
+      } else if (in->is_Phi()) {
+        if (!visited.test_set(in->_idx)) {
+          stack.push(in, 1); // ignore control
+        }
+      } else if (in->Opcode() == Op_VectorBox) {
+        VectorBoxNode* vbox = static_cast<VectorBoxNode*>(in);
+        if (cached_vbox == NULL) {
+          cached_vbox = vbox;
+        } else if (Type::cmp(vbox->vec_type(), cached_vbox->vec_type()) != 0 ||
+                   Type::cmp(vbox->box_type(), cached_vbox->box_type()) != 0) {
+          return NULL; // not optimizable: type mismatch
+        }
+      } else {
+        return NULL; // not optimizable: neither Phi nor VectorBox
+      }
+    } else {
+      stack.pop();
+    }
+  }
+  if (cached_vbox == NULL) {
+    return NULL; // only dead paths or Phi cycles
+  }
+  const TypeInstPtr* btype = cached_vbox->box_type();
+  const TypeVect*    vtype = cached_vbox->vec_type();
+  Node* new_vbox_phi = clone_through_phi(root_phi, btype, VectorBoxNode::Box,   igvn);
+  Node* new_vect_phi = clone_through_phi(root_phi, vtype, VectorBoxNode::Value, igvn);
+  return new VectorBoxNode(igvn->C, new_vbox_phi, new_vect_phi, btype, vtype);
+}
+
 //------------------------------Ideal------------------------------------------
 // Return a node which is more "ideal" than the current node.  Must preserve
 // the CFG, but we can still strip out dead paths.
@@ -2382,44 +2474,8 @@ Node *PhiNode::Ideal(PhaseGVN *phase, bool can_reshape) {
 #endif
 
   // Phi (VB ... VB) => VB (Phi ...) (Phi ...)
-  if (EnableVectorReboxing && can_reshape && progress == NULL) {
-    PhaseIterGVN* igvn = phase->is_IterGVN();
-
-    bool all_inputs_are_equiv_vboxes = true;
-    for (uint i = 1; i < req(); ++i) {
-      Node* n = in(i);
-      if (in(i)->Opcode() != Op_VectorBox) {
-        all_inputs_are_equiv_vboxes = false;
-        break;
-      }
-      // Check that vector type of vboxes is equivalent
-      if (i != 1) {
-        if (Type::cmp(in(i-0)->in(VectorBoxNode::Value)->bottom_type(),
-                      in(i-1)->in(VectorBoxNode::Value)->bottom_type()) != 0) {
-          all_inputs_are_equiv_vboxes = false;
-          break;
-        }
-        if (Type::cmp(in(i-0)->in(VectorBoxNode::Box)->bottom_type(),
-                      in(i-1)->in(VectorBoxNode::Box)->bottom_type()) != 0) {
-          all_inputs_are_equiv_vboxes = false;
-          break;
-        }
-      }
-    }
-
-    if (all_inputs_are_equiv_vboxes) {
-      VectorBoxNode* vbox = static_cast<VectorBoxNode*>(in(1));
-      PhiNode* new_vbox_phi = new PhiNode(r, vbox->box_type());
-      PhiNode* new_vect_phi = new PhiNode(r, vbox->vec_type());
-      for (uint i = 1; i < req(); ++i) {
-        VectorBoxNode* old_vbox = static_cast<VectorBoxNode*>(in(i));
-        new_vbox_phi->set_req(i, old_vbox->in(VectorBoxNode::Box));
-        new_vect_phi->set_req(i, old_vbox->in(VectorBoxNode::Value));
-      }
-      igvn->register_new_node_with_optimizer(new_vbox_phi, this);
-      igvn->register_new_node_with_optimizer(new_vect_phi, this);
-      progress = new VectorBoxNode(igvn->C, new_vbox_phi, new_vect_phi, vbox->box_type(), vbox->vec_type());
-    }
+  if (EnableVectorReboxing && can_reshape && progress == NULL && type()->isa_oopptr() != NULL) {
+    progress = merge_through_phi(this, phase->is_IterGVN());
   }
 
   return progress;              // Return any progress
@@ -32,11 +32,15 @@
 #include "code/nmethod.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
+#include "compiler/compilerDirectives.hpp"
+#include "compiler/compilerOracle.hpp"
 #include "compiler/disassembler.hpp"
 #include "compiler/oopMap.hpp"
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/c2/barrierSetC2.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
 #include "opto/addnode.hpp"
 #include "opto/block.hpp"
@@ -72,6 +76,7 @@
 #include "opto/vector.hpp"
 #include "opto/vectornode.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -254,6 +259,7 @@ void Compile::print_statistics() {
     PhaseOutput::print_statistics();
     PhasePeephole::print_statistics();
     PhaseIdealLoop::print_statistics();
+    PhaseMacroExpand::print_statistics();
     if (xtty != NULL)  xtty->tail("statistics");
   }
   if (_intrinsic_hist_flags[as_int(vmIntrinsics::_none)] != 0) {
@@ -972,10 +978,21 @@ void Compile::Init(int aliaslevel) {
 
   set_do_freq_based_layout(_directive->BlockLayoutByFrequencyOption);
   _loop_opts_cnt = LoopOptsCount;
+  _optimize_start_ns = 0;
+  _over_time_budget = false;
+  // The time budget makes the generated code depend on machine load. Keep
+  // compiles reproducible under replay and when a CompileCommand or a
+  // compiler directive controls the compilation.
+  _use_time_budget = OptimizeTimeBudget > 0 && !ReplayCompiles &&
+                     !CompilerOracle::has_any_command_set() &&
+                     !_directive->is_exclusive_copy() &&
+                     _directive->directive()->is_default_directive();
   set_do_inlining(Inline);
-  set_max_inline_size(MaxInlineSize);
-  set_freq_inline_size(FreqInlineSize);
+  set_max_inline_size(_directive->MaxInlineSizeOption);
+  set_freq_inline_size(_directive->FreqInlineSizeOption);
   set_do_scheduling(OptoScheduling);
+  // A directive can only turn SuperWord off; the backend may not support it.
+  set_do_superword(UseSuperWord && _directive->UseSuperWordOption);
 
   set_do_vector_loop(false);
 
@@ -2018,11 +2035,41 @@ bool Compile::optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode) {
       _loop_opts_cnt--;
       if (failing())  return false;
       if (major_progress()) print_method(PHASE_PHASEIDEALLOOP_ITERATIONS, 2);
+      check_time_budget();
     }
   }
   return true;
 }
 
+void Compile::check_time_budget() {
+  if (!_use_time_budget || _over_time_budget) {
+    return;
+  }
+  jlong elapsed_ms = (os::javaTimeNanos() - _optimize_start_ns) / NANOSECS_PER_MILLISEC;
+  if (elapsed_ms < (jlong)OptimizeTimeBudget) {
+    return;
+  }
+  // Skipping the remaining rounds is the same as running out of
+  // LoopOptsCount, so the graph stays valid.
+  _over_time_budget = true;
+  _loop_opts_cnt = 0;
+  if (log() != NULL) {
+    log()->elem("time_budget_exceeded elapsed_ms='" JLONG_FORMAT "'", elapsed_ms);
+  }
+  LogTarget(Debug, jit, compilation) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    ls.print("Optimize time budget exceeded after " JLONG_FORMAT "ms, skipping further loop opts: ", elapsed_ms);
+    method()->print_short_name(&ls);
+    ls.cr();
+  }
+#ifndef PRODUCT
+  if (PrintOpto) {
+    tty->print_cr("Optimize time budget exceeded after " JLONG_FORMAT "ms, skipping further loop opts", elapsed_ms);
+  }
+#endif
+}
+
 // Remove edges from "root" to each SafePoint at a backward branch.
 // They were inserted during parsing (see add_safepoint()) to make
 // infinite loops without calls or exceptions visible to root, i.e.,
@@ -2052,6 +2099,7 @@ void Compile::remove_root_to_sfpts_edges(PhaseIterGVN& igvn) {
 // Given a graph, optimize it.
 void Compile::Optimize() {
   TracePhase tp("optimizer", &timers[_t_optimizer]);
+  _optimize_start_ns = os::javaTimeNanos();
 
 #ifndef PRODUCT
   if (env()->break_at_compile()) {
@@ -2148,8 +2196,10 @@ void Compile::Optimize() {
     set_for_igvn(save_for_igvn);
   }
 
+  check_time_budget();
+
   // Perform escape analysis
-  if (_do_escape_analysis && ConnectionGraph::has_candidates(this)) {
+  if (_do_escape_analysis && !_over_time_budget && ConnectionGraph::has_candidates(this)) {
     if (has_loops()) {
       // Cleanup graph (remove dead nodes).
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
@@ -2183,6 +2233,8 @@ void Compile::Optimize() {
   // Loop transforms on the ideal graph.  Range Check Elimination,
   // peeling, unrolling, etc.
 
+  check_time_budget();
+
   // Set loop opts counter
   if((_loop_opts_cnt > 0) && (has_loops() || has_split_ifs())) {
     {
@@ -4731,17 +4783,35 @@ void Compile::sort_macro_nodes() {
   }
 }
 
+void Compile::stamp_stage_start() {
+  _latest_stage_start_counter.stamp();
+  // Thread CPU time is only needed for the CompilerPhase event.
+  _latest_stage_start_cpu_time = EventCompilerPhase::is_enabled() ? os::current_thread_cpu_time() : -1;
+}
+
+void Compile::post_phase_event(EventCompilerPhase& event, int phase, int level) {
+  jlong cpu_time = 0;
+  if (_latest_stage_start_cpu_time >= 0) {
+    cpu_time = os::current_thread_cpu_time() - _latest_stage_start_cpu_time;
+  }
+  const size_t arena_size = comp_arena()->size_in_bytes() +
+                            node_arena()->size_in_bytes() +
+                            old_arena()->size_in_bytes() +
+                            Thread::current()->resource_area()->size_in_bytes();
+  CompilerEvent::PhaseEvent::post(event, _latest_stage_start_counter, phase, _compile_id, level, cpu_time, arena_size);
+}
+
 void Compile::print_method(CompilerPhaseType cpt, const char *name, int level) {
   EventCompilerPhase event;
   if (event.should_commit()) {
-    CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, cpt, C->_compile_id, level);
+    C->post_phase_event(event, cpt, level);
   }
 #ifndef PRODUCT
   if (should_print(level)) {
     _printer->print_method(name, level);
   }
 #endif
-  C->_latest_stage_start_counter.stamp();
+  C->stamp_stage_start();
 }
 
 void Compile::print_method(CompilerPhaseType cpt, int level, int idx) {
@@ -4771,7 +4841,7 @@ void Compile::print_method(CompilerPhaseType cpt, Node* n, int level) {
 void Compile::end_method(int level) {
   EventCompilerPhase event;
   if (event.should_commit()) {
-    CompilerEvent::PhaseEvent::post(event, C->_latest_stage_start_counter, PHASE_END, C->_compile_id, level);
+    C->post_phase_event(event, PHASE_END, level);
   }
 
 #ifndef PRODUCT
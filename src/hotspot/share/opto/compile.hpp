@@ -287,6 +287,7 @@ class Compile : public Phase {
   bool                  _do_scheduling;         // True if we intend to do scheduling
   bool                  _do_freq_based_layout;  // True if we intend to do frequency based block layout
   bool                  _do_vector_loop;        // True if allowed to execute loop in parallel iterations
+  bool                  _do_superword;          // True if we intend to do SuperWord vectorization
   bool                  _use_cmove;             // True if CMove should be used without profitability analysis
   bool                  _age_code;              // True if we need to profile code age (decrement the aging counter)
   int                   _AliasLevel;            // Locally-adjusted version of AliasLevel flag.
@@ -304,6 +305,9 @@ class Compile : public Phase {
   bool                  _has_method_handle_invokes; // True if this method has MethodHandle invokes.
   RTMState              _rtm_state;             // State of Restricted Transactional Memory usage
   int                   _loop_opts_cnt;         // loop opts round
+  jlong                 _optimize_start_ns;     // Start time of Optimize()
+  bool                  _over_time_budget;      // Optimize() exceeded OptimizeTimeBudget
+  bool                  _use_time_budget;       // OptimizeTimeBudget applies to this compilation
   bool                  _clinit_barrier_on_entry; // True if clinit barrier is needed on nmethod entry
   uint                  _stress_seed;           // Seed for stress testing
 
@@ -576,6 +580,8 @@ class Compile : public Phase {
   void          set_do_freq_based_layout(bool z){ _do_freq_based_layout = z; }
   bool              do_vector_loop() const      { return _do_vector_loop; }
   void          set_do_vector_loop(bool z)      { _do_vector_loop = z; }
+  bool              do_superword() const        { return _do_superword; }
+  void          set_do_superword(bool z)        { _do_superword = z; }
   bool              use_cmove() const           { return _use_cmove; }
   void          set_use_cmove(bool z)           { _use_cmove = z; }
   bool              age_code() const             { return _age_code; }
@@ -617,6 +623,12 @@ class Compile : public Phase {
   void          set_has_method_handle_invokes(bool z) {        _has_method_handle_invokes = z; }
 
   Ticks _latest_stage_start_counter;
+  // Thread CPU time at the start of the current stage, or -1 if the
+  // CompilerPhase event was not enabled when the stage started.
+  jlong _latest_stage_start_cpu_time;
+
+  void stamp_stage_start();
+  void post_phase_event(EventCompilerPhase& event, int phase, int level);
 
   void begin_method(int level = 1) {
 #ifndef PRODUCT
@@ -624,7 +636,7 @@ class Compile : public Phase {
       _printer->begin_method();
     }
 #endif
-    C->_latest_stage_start_counter.stamp();
+    C->stamp_stage_start();
   }
 
   bool should_print(int level = 1) {
@@ -876,6 +888,8 @@ class Compile : public Phase {
   CallGenerator*    call_generator(ciMethod* call_method, int vtable_index, bool call_does_dispatch,
                                    JVMState* jvms, bool allow_inline, float profile_factor, ciKlass* speculative_receiver_type = NULL,
                                    bool allow_intrinsics = true);
+  CallGenerator*    call_generator_polymorphic(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                               bool allow_inline, float prof_factor, ciCallProfile& profile);
   bool should_delay_inlining(ciMethod* call_method, JVMState* jvms) {
     return should_delay_string_inlining(call_method, jvms) ||
            should_delay_boxing_inlining(call_method, jvms) ||
@@ -994,6 +1008,9 @@ class Compile : public Phase {
   void inline_string_calls(bool parse_time);
   void inline_boxing_calls(PhaseIterGVN& igvn);
   bool optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode);
+  // Once Optimize() has taken longer than OptimizeTimeBudget, continue with a
+  // reduced pipeline without more loop opts rounds and escape analysis.
+  void check_time_budget();
   void remove_root_to_sfpts_edges(PhaseIterGVN& igvn);
 
   void inline_vector_reboxing_calls();
@@ -63,6 +63,82 @@ void trace_type_profile(Compile* C, ciMethod *method, int depth, int bci, ciMeth
   }
 }
 
+// Build a type switch over the most frequent receivers of a polymorphic
+// call site: a chain of predicted calls, one per inlined receiver, that
+// ends in an uncommon trap if all receivers of the profile are inlined or
+// in a virtual call otherwise.
+CallGenerator* Compile::call_generator_polymorphic(ciMethod* callee, int vtable_index, JVMState* jvms,
+                                                   bool allow_inline, float prof_factor, ciCallProfile& profile) {
+  int limit = MIN2((int)directive()->PolymorphicInlineLimitOption, (int)ciCallProfile::MorphismLimit);
+  if (limit < 2 || !profile.has_receiver(1)) {
+    return NULL;
+  }
+  ciMethod* caller = jvms->method();
+  int bci = jvms->bci();
+
+  ciMethod* receiver_methods[ciCallProfile::MorphismLimit];
+  CallGenerator* hit_cgs[ciCallProfile::MorphismLimit];
+  int num_receivers = 0;
+  int num_inlined = 0;
+  float inlined_prob = 0.0;
+  for (; num_receivers < limit && profile.has_receiver(num_receivers); num_receivers++) {
+    int i = num_receivers;
+    receiver_methods[i] = callee->resolve_invoke(caller->holder(), profile.receiver(i));
+    hit_cgs[i] = NULL;
+    if (receiver_methods[i] != NULL) {
+      CallGenerator* hit_cg = call_generator(receiver_methods[i], vtable_index, false,
+                                             jvms, allow_inline, prof_factor);
+      // Only inlined receivers are worth a type check
+      if (hit_cg != NULL && hit_cg->is_inline()) {
+        hit_cgs[i] = hit_cg;
+        num_inlined++;
+        inlined_prob += profile.receiver_prob(i);
+      }
+    }
+  }
+  // The inlined receivers together must be as frequent as a major receiver.
+  if (num_inlined < 2 || 100. * inlined_prob < (float)TypeProfileMajorReceiverPercent) {
+    return NULL;
+  }
+
+  CallGenerator* miss_cg = NULL;
+  if (num_inlined == profile.morphism() &&
+      !too_many_traps_or_recompiles(caller, bci, Deoptimization::Reason_bimorphic)) {
+    // The profile saw no other receiver
+    miss_cg = CallGenerator::for_uncommon_trap(callee, Deoptimization::Reason_bimorphic,
+                                               Deoptimization::Action_maybe_recompile);
+  } else {
+    miss_cg = (IncrementalInlineVirtual ? CallGenerator::for_late_inline_virtual(callee, vtable_index, prof_factor)
+                                        : CallGenerator::for_virtual_call(callee, vtable_index));
+  }
+  if (miss_cg == NULL) {
+    return NULL;
+  }
+
+  // Build the chain from the least frequent receiver up. The probability
+  // of each type check is conditional on the ones before it failing.
+  float remaining_prob = 1.0;
+  float prob_before[ciCallProfile::MorphismLimit];
+  for (int i = 0; i < num_receivers; i++) {
+    prob_before[i] = remaining_prob;
+    if (hit_cgs[i] != NULL) {
+      remaining_prob -= profile.receiver_prob(i);
+    }
+  }
+  for (int i = num_receivers - 1; i >= 0 && miss_cg != NULL; i--) {
+    if (hit_cgs[i] == NULL) {
+      continue;
+    }
+    trace_type_profile(this, caller, jvms->depth() - 1, bci, receiver_methods[i], profile.receiver(i),
+                       profile.count(), profile.receiver_count(i));
+    float hit_prob = prob_before[i] > 0 ? MIN2(profile.receiver_prob(i) / prob_before[i], PROB_MAX) : PROB_MAX;
+    // We don't need to record dependency on a receiver here, it is added
+    // by Parse::Parse() when the receiver's method is inlined.
+    miss_cg = CallGenerator::for_predicted_call(profile.receiver(i), miss_cg, hit_cgs[i], hit_prob);
+  }
+  return miss_cg;
+}
+
 CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool call_does_dispatch,
                                        JVMState* jvms, bool allow_inline,
                                        float prof_factor, ciKlass* speculative_receiver_type,
@@ -273,6 +349,10 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
             }
           }
         }
+      } else if (speculative_receiver_type == NULL && morphism != 2) {
+        // No major receiver: try a type switch over the most frequent ones.
+        CallGenerator* cg = call_generator_polymorphic(callee, vtable_index, jvms, allow_inline, prof_factor, profile);
+        if (cg != NULL)  return cg;
       }
     }
 
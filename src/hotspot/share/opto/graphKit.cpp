@@ -3072,6 +3072,62 @@ void GraphKit::guard_init_thread(Node* klass) {
   }
 }
 
+// Call into the runtime to initialize the class unless it is already fully
+// initialized. The runtime call waits for an initialization by another thread
+// and returns immediately for a recursive initialization by the current one.
+void GraphKit::initialize_klass_if_needed(Node* klass) {
+  int init_state_off = in_bytes(InstanceKlass::init_state_offset());
+  Node* adr = basic_plus_adr(top(), klass, init_state_off);
+  Node* init_state = LoadNode::make(_gvn, NULL, immutable_memory(), adr,
+                                    adr->bottom_type()->is_ptr(), TypeInt::BYTE,
+                                    T_BYTE, MemNode::unordered);
+  init_state = _gvn.transform(init_state);
+
+  Node* initialized_state = makecon(TypeInt::make(InstanceKlass::fully_initialized));
+
+  Node* chk = _gvn.transform(new CmpINode(initialized_state, init_state));
+  Node* tst = _gvn.transform(new BoolNode(chk, BoolTest::eq));
+
+  IfNode* iff = create_and_map_if(control(), tst, PROB_MAX, COUNT_UNKNOWN);
+
+  RegionNode* result_rgn = new RegionNode(3);
+  record_for_igvn(result_rgn);
+
+  Node* initialized = _gvn.transform(new IfTrueNode(iff));
+  result_rgn->init_req(1, initialized);
+
+  set_control(_gvn.transform(new IfFalseNode(iff)));
+  Node* call;
+  {
+    // Re-execute the bytecode after deoptimization at the call.
+    PreserveReexecuteState preexecs(this);
+    jvms()->set_should_reexecute(true);
+    call = make_runtime_call(RC_NO_LEAF,
+                             OptoRuntime::class_init_Type(),
+                             OptoRuntime::class_init_Java(),
+                             NULL, TypePtr::BOTTOM,
+                             klass);
+    make_slow_call_ex(call, env()->Throwable_klass(), true);
+  }
+
+  Node* fast_io  = call->in(TypeFunc::I_O);
+  Node* fast_mem = call->in(TypeFunc::Memory);
+  Node* io_phi   = PhiNode::make(result_rgn, fast_io,  Type::ABIO);
+  Node* mem_phi  = PhiNode::make(result_rgn, fast_mem, Type::MEMORY, TypePtr::BOTTOM);
+
+  result_rgn->init_req(2, control());
+  io_phi    ->init_req(2, i_o());
+  mem_phi   ->init_req(2, reset_memory());
+
+  set_all_memory(_gvn.transform(mem_phi));
+  set_i_o(_gvn.transform(io_phi));
+  set_control(_gvn.transform(result_rgn));
+
+  // Order the accesses to the class after the load of its state, which may
+  // have been published by another thread.
+  insert_mem_bar(Op_MemBarAcquire, init_state);
+}
+
 void GraphKit::clinit_barrier(ciInstanceKlass* ik, ciMethod* context) {
   if (ik->is_being_initialized()) {
     if (C->needs_clinit_barrier(ik, context)) {
@@ -3082,6 +3138,8 @@ void GraphKit::clinit_barrier(ciInstanceKlass* ik, ciMethod* context) {
     }
   } else if (ik->is_initialized()) {
     return; // no barrier needed
+  } else if (UseClassInitRuntimeCall && !ik->is_in_error_state()) {
+    initialize_klass_if_needed(makecon(TypeKlassPtr::make(ik)));
   } else {
     uncommon_trap(Deoptimization::Reason_uninitialized,
                   Deoptimization::Action_reinterpret,
@@ -395,6 +395,7 @@ class GraphKit : public Phase {
 
   void guard_klass_being_initialized(Node* klass);
   void guard_init_thread(Node* klass);
+  void initialize_klass_if_needed(Node* klass);
 
   void clinit_barrier(ciInstanceKlass* ik, ciMethod* context);
 
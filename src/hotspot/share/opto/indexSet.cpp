@@ -112,6 +112,9 @@ IndexSet::BitBlock *IndexSet::alloc_block_containing(uint element) {
   BitBlock *block = alloc_block();
   uint bi = get_block_index(element);
   if (bi >= _current_block_limit) {
+    for (uint i = _current_block_limit; i < bi; i++) {
+      _blocks[i] = &_empty_block;
+    }
     _current_block_limit = bi + 1;
   }
   _blocks[bi] = block;
@@ -123,7 +126,7 @@ IndexSet::BitBlock *IndexSet::alloc_block_containing(uint element) {
 
 void IndexSet::free_block(uint i) {
   debug_only(check_watch("free block", i));
-  assert(i < _max_blocks, "block index too large");
+  assert(i < _current_block_limit, "block index too large");
   BitBlock *block = _blocks[i];
   assert(block != &_empty_block, "cannot free the empty block");
   block->set_next((IndexSet::BitBlock*)Compile::current()->indexSet_free_block_list());
@@ -235,7 +238,7 @@ IndexSet::IndexSet (IndexSet *set) {
     _blocks =
       (IndexSet::BitBlock**) arena()->Amalloc_4(sizeof(IndexSet::BitBlock**) * _max_blocks);
   }
-  for (uint i = 0; i < _max_blocks; i++) {
+  for (uint i = 0; i < _current_block_limit; i++) {
     BitBlock *block = set->_blocks[i];
     if (block == &_empty_block) {
       set_block(i, &_empty_block);
@@ -265,9 +268,6 @@ void IndexSet::initialize(uint max_elements) {
   } else {
     _blocks = (IndexSet::BitBlock**) arena()->Amalloc_4(sizeof(IndexSet::BitBlock*) * _max_blocks);
   }
-  for (uint i = 0; i < _max_blocks; i++) {
-    set_block(i, &_empty_block);
-  }
 }
 
 //---------------------------- IndexSet::initialize()------------------------------
@@ -290,9 +290,6 @@ void IndexSet::initialize(uint max_elements, Arena *arena) {
   } else {
     _blocks = (IndexSet::BitBlock**) arena->Amalloc_4(sizeof(IndexSet::BitBlock*) * _max_blocks);
   }
-  for (uint i = 0; i < _max_blocks; i++) {
-    set_block(i, &_empty_block);
-  }
 }
 
 //---------------------------- IndexSet::swap() -----------------------------
@@ -307,17 +304,17 @@ void IndexSet::swap(IndexSet *set) {
 
   uint max = MAX2(_current_block_limit, set->_current_block_limit);
   for (uint i = 0; i < max; i++) {
-    BitBlock *temp = _blocks[i];
-    set_block(i, set->_blocks[i]);
-    set->set_block(i, temp);
+    BitBlock *temp = i < _current_block_limit ? _blocks[i] : &_empty_block;
+    _blocks[i] = i < set->_current_block_limit ? set->_blocks[i] : &_empty_block;
+    set->_blocks[i] = temp;
   }
   uint temp = _count;
   _count = set->_count;
   set->_count = temp;
 
-  temp = _current_block_limit;
-  _current_block_limit = set->_current_block_limit;
-  set->_current_block_limit = temp;
+  // Both sets are now initialized up to max.
+  _current_block_limit = max;
+  set->_current_block_limit = max;
 
 }
 
@@ -344,13 +341,14 @@ void IndexSet::dump() const {
 void IndexSet::tally_iteration_statistics() const {
   inc_stat_counter(&_total_bits, count());
 
-  for (uint i = 0; i < _max_blocks; i++) {
+  for (uint i = 0; i < _current_block_limit; i++) {
     if (_blocks[i] != &_empty_block) {
       inc_stat_counter(&_total_used_blocks, 1);
     } else {
       inc_stat_counter(&_total_unused_blocks, 1);
     }
   }
+  inc_stat_counter(&_total_unused_blocks, _max_blocks - _current_block_limit);
 }
 
 //---------------------------- IndexSet::print_statistics() -----------------------------
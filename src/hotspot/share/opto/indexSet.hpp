@@ -183,9 +183,10 @@ class IndexSet : public ResourceObj {
 
  private:
   friend class BitBlock;
-  // A distinguished BitBlock which always remains empty.  When a new IndexSet is
-  // created, all of its top level BitBlock pointers are initialized to point to
-  // this.
+  // A distinguished BitBlock which always remains empty.  All top level
+  // BitBlock pointers of an IndexSet that do not refer to a block in use,
+  // including the uninitialized ones above _current_block_limit, stand for
+  // this block.
   static BitBlock _empty_block;
 
   //-------------------------- Members ------------------------------------------
@@ -196,7 +197,10 @@ class IndexSet : public ResourceObj {
   // The current upper limit of blocks that has been allocated and might be in use
   uint      _current_block_limit;
 
-  // Our top level array of bitvector segments
+  // Our top level array of bitvector segments. Only the entries below
+  // _current_block_limit are initialized, all blocks above it are empty.
+  // This keeps initialization of the many sets of large interference
+  // graphs cheap.
   BitBlock **_blocks;
 
   BitBlock  *_preallocated_block_list[preallocated_block_list_size];
@@ -230,11 +234,13 @@ class IndexSet : public ResourceObj {
   // Get the block which holds element
   BitBlock *get_block_containing(uint element) const {
     assert(element < _max_elements, "element out of bounds");
-    return _blocks[get_block_index(element)];
+    uint index = get_block_index(element);
+    return index < _current_block_limit ? _blocks[index] : &_empty_block;
   }
 
   // Set a block in the top level array
   void set_block(uint index, BitBlock *block) {
+    assert(index < _current_block_limit, "block index above limit");
     _blocks[index] = block;
   }
 
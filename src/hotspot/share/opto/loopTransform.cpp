@@ -789,8 +789,9 @@ bool IdealLoopTree::policy_maximally_unroll(PhaseIdealLoop* phase) const {
   assert(!phase->exceeding_node_budget(), "sanity");
 
   // Allow the unrolled body to get larger than the standard loop size limit.
-  uint unroll_limit = (uint)LoopUnrollLimit * 4;
-  assert((intx)unroll_limit == LoopUnrollLimit * 4, "LoopUnrollLimit must fit in 32bits");
+  const intx loop_unroll_limit = phase->C->directive()->LoopUnrollLimitOption;
+  uint unroll_limit = (uint)loop_unroll_limit * 4;
+  assert((intx)unroll_limit == loop_unroll_limit * 4, "LoopUnrollLimit must fit in 32bits");
   if (trip_count > unroll_limit || _body.size() > unroll_limit) {
     return false;
   }
@@ -864,7 +865,8 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
   if (cl->trip_count() <= (cl->is_normal_loop() ? 2u : 1u)) {
     return false;
   }
-  _local_loop_unroll_limit  = LoopUnrollLimit;
+  const intx loop_unroll_limit = phase->C->directive()->LoopUnrollLimitOption;
+  _local_loop_unroll_limit  = loop_unroll_limit;
   _local_loop_unroll_factor = 4;
   int future_unroll_cnt = cl->unrolled_count() * 2;
   if (!cl->is_vectorized_loop()) {
@@ -893,7 +895,7 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
   //   the residual iterations are more than 10% of the trip count
   //   and rounds of "unroll,optimize" are not making significant progress
   //   Progress defined as current size less than 20% larger than previous size.
-  if (UseSuperWord && cl->node_count_before_unroll() > 0 &&
+  if (phase->C->do_superword() && cl->node_count_before_unroll() > 0 &&
       future_unroll_cnt > LoopUnrollMin &&
       (future_unroll_cnt - 1) * (100 / LoopPercentProfileLimit) > cl->profile_trip_cnt() &&
       1.2 * cl->node_count_before_unroll() < (double)_body.size()) {
@@ -970,7 +972,7 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
     } // switch
   }
 
-  if (UseSuperWord) {
+  if (phase->C->do_superword()) {
     if (!cl->is_reduction_loop()) {
       phase->mark_reductions(this);
     }
@@ -1001,7 +1003,7 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
 
   // Check for being too big
   if (body_size > (uint)_local_loop_unroll_limit) {
-    if ((cl->is_subword_loop() || xors_in_loop >= 4) && body_size < 4u * LoopUnrollLimit) {
+    if ((cl->is_subword_loop() || xors_in_loop >= 4) && body_size < 4u * loop_unroll_limit) {
       return phase->may_require_nodes(estimate);
     }
     return false; // Loop too big.
@@ -1039,7 +1041,7 @@ void IdealLoopTree::policy_unroll_slp_analysis(CountedLoopNode *cl, PhaseIdealLo
       int slp_max_unroll_factor = cl->slp_max_unroll();
       if (slp_max_unroll_factor >= future_unroll_cnt) {
         int new_limit = cl->node_count_before_unroll() * slp_max_unroll_factor;
-        if (new_limit > LoopUnrollLimit) {
+        if (new_limit > phase->C->directive()->LoopUnrollLimitOption) {
           if (TraceSuperWordLoopUnrollAnalysis) {
             tty->print_cr("slp analysis unroll=%d, default limit=%d\n", new_limit, _local_loop_unroll_limit);
           }
@@ -1944,7 +1946,7 @@ void PhaseIdealLoop::update_main_loop_skeleton_predicates(Node* ctrl, CountedLoo
 //------------------------------do_unroll--------------------------------------
 // Unroll the loop body one step - make each trip do 2 iterations.
 void PhaseIdealLoop::do_unroll(IdealLoopTree *loop, Node_List &old_new, bool adjust_min_trip) {
-  assert(LoopUnrollLimit, "");
+  assert(C->directive()->LoopUnrollLimitOption, "");
   CountedLoopNode *loop_head = loop->_head->as_CountedLoop();
   CountedLoopEndNode *loop_end = loop_head->loopexit();
 #ifndef PRODUCT
@@ -1952,7 +1954,7 @@ void PhaseIdealLoop::do_unroll(IdealLoopTree *loop, Node_List &old_new, bool adj
     tty->print("Unrolling ");
     loop->dump_head();
   } else if (TraceLoopOpts) {
-    if (loop_head->trip_count() < (uint)LoopUnrollLimit) {
+    if (loop_head->trip_count() < (uint)C->directive()->LoopUnrollLimitOption) {
       tty->print("Unroll %d(%2d) ", loop_head->unrolled_count()*2, loop_head->trip_count());
     } else {
       tty->print("Unroll %d     ", loop_head->unrolled_count()*2);
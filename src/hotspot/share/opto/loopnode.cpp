@@ -548,6 +548,119 @@ void PhaseIdealLoop::long_loop_replace_long_iv(Node* iv_to_replace, Node* inner_
   }
 }
 
+// Returns true if n is a range check of the form "iv + offset u< range"
+// on long values with offset and range invariant in the loop and range
+// known to be non negative, as emitted for Objects.checkIndex(long, long).
+bool PhaseIdealLoop::is_long_range_check(IdealLoopTree* loop, Node* n, Node* iv, Node*& offset, Node*& range) {
+  if (!n->is_RangeCheck() || !n->in(1)->is_Bool()) {
+    return false;
+  }
+  BoolNode* bol = n->in(1)->as_Bool();
+  if (bol->_test._test != BoolTest::lt || bol->in(1)->Opcode() != Op_CmpUL) {
+    return false;
+  }
+  Node* cmp = bol->in(1);
+  range = cmp->in(2);
+  if (!loop->is_invariant(range)) {
+    return false;
+  }
+  const TypeLong* range_t = _igvn.type(range)->isa_long();
+  if (range_t == NULL || range_t->empty() || range_t->_lo < 0) {
+    return false;
+  }
+  Node* idx = cmp->in(1)->uncast();
+  if (idx == iv) {
+    offset = _igvn.longcon(0);
+    set_ctrl(offset, C->root());
+    return true;
+  }
+  if (idx->Opcode() == Op_AddL) {
+    for (uint i = 1; i <= 2; i++) {
+      Node* other = idx->in(3 - i);
+      if (idx->in(i)->uncast() == iv && loop->is_invariant(other)) {
+        offset = other;
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+// Collect the long range checks of the body of a long counted loop
+// that transform_long_range_checks() can turn into integer range
+// checks of the inner loop of the loop nest. Only loops with a
+// positive stride are handled. The list holds triples of range check,
+// offset and range.
+void PhaseIdealLoop::extract_long_range_checks(IdealLoopTree* loop, jlong stride_con, Node* iv, Node_List& range_checks) {
+  if (stride_con <= 0) {
+    return;
+  }
+  for (uint i = 0; i < loop->_body.size(); i++) {
+    Node* n = loop->_body.at(i);
+    Node* offset = NULL;
+    Node* range = NULL;
+    if (is_long_range_check(loop, n, iv, offset, range)) {
+      range_checks.push(n);
+      range_checks.push(offset);
+      range_checks.push(range);
+    }
+  }
+}
+
+// Once a long counted loop is transformed into a loop nest, a long
+// range check:
+//
+// if (outer_phi + inner_phi + offset u< range)   // long compare
+//
+// is equivalent to an integer range check on the inner loop iv:
+//
+// Q = clamp(outer_phi + offset, -H, range)
+// L = max(-Q, 0)
+// R = unsigned_min(range - Q, H)
+// if (inner_phi - (int)L u< (int)R - (int)L)     // int compare
+//
+// where H is the number of iterations of the inner loop (inner_phi
+// is in [0, H)). L and R are in [0, H] so they fit in an int and
+// are invariant in the inner loop: the new check is a candidate for
+// range check elimination and predication of the inner loop.
+void PhaseIdealLoop::transform_long_range_checks(const Node_List& range_checks, Node* outer_phi, Node* inner_iters_actual,
+                                                 Node* inner_phi, Node* inner_head) {
+  if (range_checks.size() == 0) {
+    return;
+  }
+  const TypeLong* iters_t = _igvn.type(inner_iters_actual)->is_long();
+  const TypeLong* clamped_t = TypeLong::make(0, iters_t->_hi, Type::WidenMin);
+  Node* zero = _igvn.longcon(0);
+  set_ctrl(zero, C->root());
+  Node* minus_iters = _igvn.transform(new SubLNode(zero, inner_iters_actual));
+  for (uint i = 0; i < range_checks.size(); i += 3) {
+    Node* rc = range_checks.at(i);
+    Node* offset = range_checks.at(i + 1);
+    Node* range = range_checks.at(i + 2);
+
+    Node* q = _igvn.transform(new AddLNode(outer_phi, offset));
+    q = MaxNode::signed_max(q, minus_iters, TypeLong::LONG, _igvn);
+    q = MaxNode::signed_min(q, range, TypeLong::LONG, _igvn);
+    Node* l = MaxNode::max_diff_with_zero(zero, q, clamped_t, _igvn);
+    Node* range_minus_q = _igvn.transform(new SubLNode(range, q));
+    Node* r = MaxNode::unsigned_min(range_minus_q, inner_iters_actual, clamped_t, _igvn);
+
+    Node* l_int = _igvn.transform(new ConvL2INode(l));
+    Node* r_int = _igvn.transform(new ConvL2INode(r));
+    Node* new_range = _igvn.transform(new SubINode(r_int, l_int));
+    set_subtree_ctrl(new_range, true);
+
+    Node* new_idx = new SubINode(inner_phi, l_int);
+    Node* new_cmp = new CmpUNode(new_idx, new_range);
+    Node* new_bol = new BoolNode(new_cmp, BoolTest::lt);
+    register_new_node(new_idx, inner_head);
+    register_new_node(new_cmp, inner_head);
+    register_new_node(new_bol, inner_head);
+
+    _igvn.replace_input_of(rc, 1, new_bol);
+  }
+}
+
 void PhaseIdealLoop::add_empty_predicate(Deoptimization::DeoptReason reason, Node* inner_head, IdealLoopTree* loop, SafePointNode* sfpt) {
   if (!C->too_many_traps(reason)) {
     Node *cont = _igvn.intcon(1);
@@ -812,6 +925,9 @@ bool PhaseIdealLoop::transform_long_counted_loop(IdealLoopTree* loop, Node_List
     return false;
   }
 
+  Node_List range_checks;
+  extract_long_range_checks(loop, stride_con, phi, range_checks);
+
   // May not have gone thru igvn yet so don't use _igvn.type(phi) (PhaseIdealLoop::is_counted_loop() sets the iv phi's type)
   const TypeLong* phi_t = phi->bottom_type()->is_long();
   assert(phi_t->_hi >= phi_t->_lo, "dead phi?");
@@ -923,6 +1039,10 @@ bool PhaseIdealLoop::transform_long_counted_loop(IdealLoopTree* loop, Node_List
 
   set_subtree_ctrl(inner_iters_actual_int, body_populated);
 
+  // Turn long range checks of the loop body into int range checks of
+  // the inner loop
+  transform_long_range_checks(range_checks, outer_phi, inner_iters_actual, inner_phi, x);
+
   LoopNode* inner_head = create_inner_head(loop, head, exit_test);
 
   // Summary of steps from inital loop to loop nest:
@@ -4051,7 +4171,7 @@ void PhaseIdealLoop::build_and_optimize(LoopOptsMode mode) {
   }
 
   // Convert scalar to superword operations at the end of all loop opts.
-  if (UseSuperWord && C->has_loops() && !C->major_progress()) {
+  if (C->do_superword() && C->has_loops() && !C->major_progress()) {
     // SuperWord transform
     SuperWord sw(this);
     for (LoopTreeIterator iter(_ltree_root); !iter.done(); iter.next()) {
@@ -4667,7 +4787,7 @@ int PhaseIdealLoop::build_loop_tree_impl( Node *n, int pre_order ) {
         if( !n->is_CallStaticJava() || !n->as_CallStaticJava()->_name ) {
           Node *iff = n->in(0)->in(0);
           // No any calls for vectorized loops.
-          if( UseSuperWord || !iff->is_If() ||
+          if( C->do_superword() || !iff->is_If() ||
               (n->in(0)->Opcode() == Op_IfFalse &&
                (1.0 - iff->as_If()->_prob) >= 0.01) ||
               (iff->as_If()->_prob >= 0.01) )
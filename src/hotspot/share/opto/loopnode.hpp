@@ -1169,6 +1169,10 @@ public:
   bool is_counted_loop(Node* x, IdealLoopTree*&loop, BasicType iv_bt);
 
   void long_loop_replace_long_iv(Node* iv_to_replace, Node* inner_iv, Node* outer_phi, Node* inner_head);
+  bool is_long_range_check(IdealLoopTree* loop, Node* n, Node* iv, Node*& offset, Node*& range);
+  void extract_long_range_checks(IdealLoopTree* loop, jlong stride_con, Node* iv, Node_List& range_checks);
+  void transform_long_range_checks(const Node_List& range_checks, Node* outer_phi, Node* inner_iters_actual,
+                                   Node* inner_phi, Node* inner_head);
   bool transform_long_counted_loop(IdealLoopTree* loop, Node_List &old_new);
 #ifdef ASSERT
   bool convert_to_long_loop(Node* cmp, Node* phi, IdealLoopTree* loop);
@@ -687,7 +687,14 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   float infrequent_prob = PROB_UNLIKELY_MAG(3);
   // Ignore cost and blocks frequency if CMOVE can be moved outside the loop.
   if (used_inside_loop) {
-    if (cost >= ConditionalMoveLimit) return NULL; // Too much goo
+    // A branch that the profile sees going both ways about equally often
+    // is likely to be mispredicted: allow more speculative ops for it.
+    int cost_limit = ConditionalMoveLimit;
+    if (UnpredictableBranchCMovePercent > 0 && iff->_fcnt != COUNT_UNKNOWN &&
+        100.0f * MIN2(iff->_prob, 1.0f - iff->_prob) >= (float)UnpredictableBranchCMovePercent) {
+      cost_limit *= 2;
+    }
+    if (cost >= cost_limit) return NULL; // Too much goo
 
     // BlockLayoutByFrequency optimization moves infrequent branch
     // from hot path. No point in CMOV'ing in such case (110 is used
@@ -51,6 +51,7 @@
 #include "opto/subtypenode.hpp"
 #include "opto/type.hpp"
 #include "prims/jvmtiExport.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/powerOfTwo.hpp"
@@ -2091,6 +2092,13 @@ bool PhaseMacroExpand::eliminate_locking_node(AbstractLockNode *alock) {
   if (PrintEliminateLocks) {
     tty->print_cr("++++ Eliminated: %d %s '%s'", alock->_idx, (alock->is_Lock() ? "Lock" : "Unlock"), alock->kind_as_string());
   }
+  if (alock->is_coarsened()) {
+    Atomic::inc(&_coarsened_locks_eliminated);
+  } else if (alock->is_nested()) {
+    Atomic::inc(&_nested_locks_eliminated);
+  } else {
+    Atomic::inc(&_non_esc_locks_eliminated);
+  }
 #endif
 
   Node* mem  = alock->in(TypeFunc::Memory);
@@ -2492,6 +2500,19 @@ void PhaseMacroExpand::expand_subtypecheck_node(SubTypeCheckNode *check) {
   _igvn.replace_node(check, C->top());
 }
 
+#ifndef PRODUCT
+int PhaseMacroExpand::_non_esc_locks_eliminated = 0;
+int PhaseMacroExpand::_coarsened_locks_eliminated = 0;
+int PhaseMacroExpand::_nested_locks_eliminated = 0;
+
+void PhaseMacroExpand::print_statistics() {
+  tty->print_cr("Macro expansion: eliminated locks and unlocks: %d non escaping, %d coarsened, %d nested",
+                Atomic::load(&_non_esc_locks_eliminated),
+                Atomic::load(&_coarsened_locks_eliminated),
+                Atomic::load(&_nested_locks_eliminated));
+}
+#endif
+
 //---------------------------eliminate_macro_nodes----------------------
 // Eliminate scalar replaced allocations and associated locks.
 void PhaseMacroExpand::eliminate_macro_nodes() {
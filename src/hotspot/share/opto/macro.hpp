@@ -207,6 +207,14 @@ public:
   void eliminate_macro_nodes();
   bool expand_macro_nodes();
 
+#ifndef PRODUCT
+  // Number of eliminated Lock and Unlock nodes, by elimination kind
+  static int _non_esc_locks_eliminated;
+  static int _coarsened_locks_eliminated;
+  static int _nested_locks_eliminated;
+  static void print_statistics();
+#endif
+
   PhaseIterGVN &igvn() const { return _igvn; }
 
   // Members accessed from BarrierSetC2
@@ -149,6 +149,7 @@ class OptoRuntime : public AllStatic {
 
   static address _slow_arraycopy_Java;
   static address _register_finalizer_Java;
+  static address _class_init_Java;
 
   //
   // Implementation of runtime methods
@@ -198,6 +199,9 @@ private:
 
   static void register_finalizer(oopDesc* obj, JavaThread* current);
 
+  // Initialize a class on first use from compiled code
+  static void class_init_C(Klass* klass, JavaThread* current);
+
  public:
 
   static bool is_callee_saved_register(MachRegisterNumbers reg);
@@ -226,6 +230,7 @@ private:
 
   static address slow_arraycopy_Java()                   { return _slow_arraycopy_Java; }
   static address register_finalizer_Java()               { return _register_finalizer_Java; }
+  static address class_init_Java()                       { return _class_init_Java; }
 
   static ExceptionBlob*    exception_blob()                      { return _exception_blob; }
 
@@ -304,6 +309,7 @@ private:
   static const TypeFunc* osr_end_Type();
 
   static const TypeFunc* register_finalizer_Type();
+  static const TypeFunc* class_init_Type();
 
   JFR_ONLY(static const TypeFunc* get_class_id_intrinsic_Type();)
 
@@ -1399,6 +1399,11 @@ const intx ObjectAlignmentInBytes = 8;
           "allocate (for testing only)")                                    \
           range(0, max_uintx)                                               \
                                                                             \
+  product(bool, TrimNativeHeapAfterChunkPoolClean, false, DIAGNOSTIC,       \
+          "Return free C-heap memory to the operating system after the "    \
+          "periodic arena chunk pool cleaning released a significant "      \
+          "amount of memory")                                               \
+                                                                            \
   product(intx, TypeProfileWidth, 2,                                        \
           "Number of receiver types to record in call/cast profile")        \
           range(0, 8)                                                       \
@@ -489,6 +489,9 @@ void before_exit(JavaThread* thread) {
   }
 
 #ifdef LINUX
+  if (WritePerfMap) {
+    CodeCache::flush_perf_map();
+  }
   if (DumpPerfMapAtExit) {
     CodeCache::write_perf_map();
   }
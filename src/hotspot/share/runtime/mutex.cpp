@@ -30,6 +30,7 @@
 #include "runtime/osThread.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
 #include "runtime/thread.inline.hpp"
+#include "runtime/timer.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
 
@@ -106,13 +107,18 @@ void Mutex::lock(Thread* self) {
   check_safepoint_state(self);
   check_rank(self);
 
+  bool contended = false;
+  jlong contended_start = 0;
   if (!_lock.try_lock()) {
     // The lock is contended, use contended slow-path function to lock
+    contended = true;
+    contended_start = os::elapsed_counter();
     lock_contended(self);
   }
 
   assert_owner(NULL);
   set_owner(self);
+  record_acquisition(contended, contended_start);
 }
 
 void Mutex::lock() {
@@ -131,9 +137,16 @@ void Mutex::lock_without_safepoint_check(Thread * self) {
   check_no_safepoint_state(self);
   check_rank(self);
 
-  _lock.lock();
+  bool contended = false;
+  jlong contended_start = 0;
+  if (!_lock.try_lock()) {
+    contended = true;
+    contended_start = os::elapsed_counter();
+    _lock.lock();
+  }
   assert_owner(NULL);
   set_owner(self);
+  record_acquisition(contended, contended_start);
 }
 
 void Mutex::lock_without_safepoint_check() {
@@ -160,6 +173,7 @@ bool Mutex::try_lock_inner(bool do_rank_checks) {
   if (_lock.try_lock()) {
     assert_owner(NULL);
     set_owner(self);
+    record_acquisition(false, 0);
     return true;
   }
   return false;
@@ -262,7 +276,8 @@ Mutex::~Mutex() {
 }
 
 Mutex::Mutex(int Rank, const char * name, bool allow_vm_block,
-             SafepointCheckRequired safepoint_check_required) : _owner(NULL) {
+             SafepointCheckRequired safepoint_check_required) : _owner(NULL),
+             _acquisitions(0), _contended_acquisitions(0), _contended_ticks(0) {
   assert(os::mutex_init_done(), "Too early!");
   assert(name != NULL, "Mutex requires a name");
   _name = os::strdup(name, mtInternal);
@@ -291,6 +306,12 @@ void Mutex::print_on_error(outputStream* st) const {
   st->print(" - owner thread: " PTR_FORMAT, p2i(owner()));
 }
 
+void Mutex::print_stats_on(outputStream* st) const {
+  st->print_cr("%-32s " UINT64_FORMAT_W(12) " " UINT64_FORMAT_W(10) " %12.3f",
+               _name, _acquisitions, _contended_acquisitions,
+               TimeHelper::counter_to_millis(_contended_ticks));
+}
+
 // ----------------------------------------------------------------------------------
 // Non-product code
 
@@ -87,6 +87,20 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   os::PlatformMonitor _lock;             // Native monitor implementation
   const char* _name;                     // Name of mutex/monitor
 
+  // Lock statistics. These are only updated by the owner while it holds the
+  // lock, so plain updates suffice; readers may see slightly stale values.
+  uint64_t _acquisitions;                // Number of lock acquisitions
+  uint64_t _contended_acquisitions;      // Number of acquisitions that had to block
+  jlong    _contended_ticks;             // Elapsed counter ticks spent blocking
+
+  void record_acquisition(bool contended, jlong contended_start) {
+    _acquisitions++;
+    if (contended) {
+      _contended_acquisitions++;
+      _contended_ticks += os::elapsed_counter() - contended_start;
+    }
+  }
+
   // Debugging fields for naming, deadlock detection, etc. (some only used in debug mode)
 #ifndef PRODUCT
   bool    _allow_vm_block;
@@ -195,6 +209,10 @@ class Mutex : public CHeapObj<mtSynchronizer> {
   const char *name() const                  { return _name; }
 
   void print_on_error(outputStream* st) const;
+  uint64_t acquisitions() const             { return _acquisitions; }
+  uint64_t contended_acquisitions() const   { return _contended_acquisitions; }
+  // Print acquisition and contention statistics of this lock.
+  void print_stats_on(outputStream* st) const;
   #ifndef PRODUCT
     void print_on(outputStream* st) const;
     void print() const                      { print_on(::tty); }
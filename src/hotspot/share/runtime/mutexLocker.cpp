@@ -384,3 +384,10 @@ void print_owned_locks_on_error(outputStream* st) {
   }
   if (none) st->print_cr("None");
 }
+
+void print_lock_stats_on(outputStream* st) {
+  st->print_cr("%-32s %12s %10s %12s", "Lock", "Acquired", "Contended", "Blocked (ms)");
+  for (int i = 0; i < _num_mutex; i++) {
+    _mutex_array[i]->print_stats_on(st);
+  }
+}
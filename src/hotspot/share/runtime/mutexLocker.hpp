@@ -179,6 +179,8 @@ extern Mutex* tty_lock;                          // lock to synchronize output.
 // Print all mutexes/monitors that are currently owned by a thread; called
 // by fatal error handler.
 void print_owned_locks_on_error(outputStream* st);
+// Print acquisition and contention statistics of all global VM locks.
+void print_lock_stats_on(outputStream* st);
 
 char *lock_name(Mutex *mutex);
 
@@ -1372,6 +1372,14 @@ ssize_t os::read(int fd, void *buf, unsigned int nBytes) {
   return ::read(fd, buf, nBytes);
 }
 
+bool os::is_fifo(const char* path) {
+  struct stat st;
+  if (os::stat(path, &st) != 0) {
+    return false;
+  }
+  return S_ISFIFO(st.st_mode);
+}
+
 bool os::set_boot_path(char fileSep, char pathSep) {
   const char* home = Arguments::get_java_home();
   int home_len = (int)strlen(home);
@@ -1823,6 +1831,9 @@ void os::print_memory_mappings(outputStream* st) {
 }
 
 void os::pretouch_memory(void* start, void* end, size_t page_size) {
+  if (start >= end || pd_pretouch_memory(start, end)) {
+    return;
+  }
   for (volatile char *p = (char*)start; p < (char*)end; p += page_size) {
     // Note: this must be a store, not a load. On many OSes loads from fresh
     // memory would be satisfied from a single mapped page containing all zeros.
@@ -158,6 +158,9 @@ class os: AllStatic {
   static bool   pd_unmap_memory(char *addr, size_t bytes);
   static void   pd_free_memory(char *addr, size_t bytes, size_t alignment_hint);
   static void   pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint);
+  // Let the OS back the given range with memory without touching every page.
+  // Returns false if not supported, in which case the caller touches them.
+  static bool   pd_pretouch_memory(void* start, void* end);
 
   static char*  pd_reserve_memory_special(size_t size, size_t alignment, size_t page_size,
 
@@ -278,7 +281,8 @@ class os: AllStatic {
     return _initial_active_processor_count;
   }
 
-  // Binds the current process to a processor.
+  // Binds the current thread to a processor. The processor_id selects
+  // among the processors the process may run on, wrapping around.
   //    Returns true if it worked, false if it didn't.
   static bool bind_to_processor(uint processor_id);
 
@@ -681,6 +685,9 @@ class os: AllStatic {
   static void pd_print_cpu_info(outputStream* st, char* buf, size_t buflen);
   static void print_summary_info(outputStream* st, char* buf, size_t buflen);
   static void print_memory_info(outputStream* st);
+  // Returns free C-heap memory to the operating system if the C library
+  // supports it. Returns false if not supported.
+  static bool trim_native_heap();
   static void print_dll_info(outputStream* st);
   static void print_environment_variables(outputStream* st, const char** env_list);
   static void print_context(outputStream* st, const void* context);
@@ -763,6 +770,8 @@ class os: AllStatic {
   // IO operations, non-JVM_ version.
   static int stat(const char* path, struct stat* sbuf);
   static bool dir_is_empty(const char* path);
+  // Returns true if path names an existing fifo (named pipe).
+  static bool is_fifo(const char* path);
 
   // IO operations on binary files
   static int create_binary_file(const char* path, bool rewrite_existing);
@@ -500,6 +500,21 @@ PerfLongVariable* PerfDataManager::create_long_variable(CounterNS ns,
   return p;
 }
 
+PerfHistogram* PerfHistogram::create(CounterNS ns, const char* name, TRAPS) {
+  PerfHistogram* h = new PerfHistogram();
+  char bucket_name[64];
+  assert(strlen(name) + 4 < sizeof(bucket_name), "histogram name too long: %s", name);
+  for (int i = 0; i < NumBuckets; i++) {
+    jio_snprintf(bucket_name, sizeof(bucket_name), "%s.%d", name, i);
+    h->_buckets[i] = PerfDataManager::create_counter(ns, bucket_name, PerfData::U_Events, THREAD);
+    if (HAS_PENDING_EXCEPTION) {
+      delete h;
+      return NULL;
+    }
+  }
+  return h;
+}
+
 PerfLongCounter* PerfDataManager::create_long_counter(CounterNS ns,
                                                       const char* name,
                                                       PerfData::Units u,
@@ -29,6 +29,7 @@
 #include "runtime/perfDataTypes.hpp"
 #include "runtime/perfMemory.hpp"
 #include "runtime/timer.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 template <typename T> class GrowableArray;
 
@@ -871,6 +872,38 @@ class PerfDataManager : AllStatic {
 
 // Utility Classes
 
+/*
+ * this class maintains a histogram with power-of-two sized buckets. Every
+ * bucket is published as a separate PerfCounter, so the histogram can be
+ * read like any other PerfData item, e.g. by jstat or by mapping the
+ * hsperfdata file. For a histogram named "ns.name", the counter
+ * "ns.name.<i>" counts the recorded values v with 2^(i-1) <= v < 2^i,
+ * "ns.name.0" counts the values smaller than 1 and the last bucket also
+ * counts all values beyond its upper bound.
+ *
+ * Updates of the bucket counters are not atomic, so values must only be
+ * recorded by a single thread at a time.
+ */
+class PerfHistogram : public CHeapObj<mtInternal> {
+  public:
+    static const int NumBuckets = 32;
+
+  private:
+    PerfCounter* _buckets[NumBuckets];
+
+    PerfHistogram() { }
+
+  public:
+    static PerfHistogram* create(CounterNS ns, const char* name, TRAPS);
+
+    void record(jlong value) {
+      int i = (value <= 0) ? 0 : MIN2(log2i(value) + 1, NumBuckets - 1);
+      _buckets[i]->inc();
+    }
+
+    jlong bucket_value(int i) const { return _buckets[i]->get_value(); }
+};
+
 /*
  * this class will administer a PerfCounter used as a time accumulator
  * for a basic block much like the TraceTime class.
@@ -908,6 +908,20 @@ static methodHandle resolve_interface_call(InstanceKlass* klass,
 
   assert(!method.is_null() , "method should not be null");
 
+  // Linktime resolution has already been done by Class.getMethod(), so the
+  // common case only needs the itable selection that invokeinterface does.
+  // Anything unusual takes the full LinkResolver path below, which throws
+  // the right errors.
+  if (method->has_itable_index() && recv_klass->is_instance_klass()) {
+    bool itable_entry_found;
+    Method* selected = InstanceKlass::cast(recv_klass)->method_at_itable_or_null(method->method_holder(),
+                                                                                 method->itable_index(),
+                                                                                 itable_entry_found);
+    if (itable_entry_found && selected != NULL && selected->is_public() && !selected->is_abstract()) {
+      return methodHandle(THREAD, selected);
+    }
+  }
+
   CallInfo info;
   Symbol*  signature  = method->signature();
   Symbol*  name       = method->name();
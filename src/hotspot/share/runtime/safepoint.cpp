@@ -40,6 +40,7 @@
 #include "gc/shared/workgroup.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -93,12 +94,14 @@ static void post_safepoint_synchronize_event(EventSafepointStateSynchronization&
                                              uint64_t safepoint_id,
                                              int initial_number_of_threads,
                                              int threads_waiting_to_block,
-                                             uint64_t iterations) {
+                                             uint64_t iterations,
+                                             JavaThread* last_running) {
   if (event.should_commit()) {
     event.set_safepointId(safepoint_id);
     event.set_initialThreadCount(initial_number_of_threads);
     event.set_runningThreadCount(threads_waiting_to_block);
     event.set_iterations(iterations);
+    event.set_lastThread(last_running != NULL ? JFR_THREAD_ID(last_running) : 0);
     event.commit();
   }
 }
@@ -205,7 +208,8 @@ static void back_off(int64_t start_time) {
   }
 }
 
-int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running)
+int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running,
+                                              JavaThread** last_running)
 {
   JavaThreadIteratorWithHandle jtiwh;
 
@@ -235,6 +239,7 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   DEBUG_ONLY(assert_list_is_valid(tss_head, still_running);)
 
   *initial_running = still_running;
+  *last_running = NULL;
 
   // If there is no thread still running, we are already done.
   if (still_running <= 0) {
@@ -257,6 +262,9 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
       assert(cur_tss->is_running(), "Illegal initial state");
       if (thread_not_running(cur_tss)) {
         --still_running;
+        if (still_running == 0) {
+          *last_running = cur_tss->thread();
+        }
         *p_prev = NULL;
         ThreadSafepointState *tmp = cur_tss;
         cur_tss = cur_tss->get_next();
@@ -335,6 +343,34 @@ void SafepointSynchronize::arm_safepoint() {
   OrderAccess::fence(); // storestore|storeload, global state -> local state
 }
 
+// Log the thread that took longest to reach the safepoint, and where it
+// stopped, to help find code with too few safepoint polls.
+static void log_last_running_thread(JavaThread* thread) {
+  LogTarget(Debug, safepoint) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+  ResourceMark rm;
+  LogStream ls(lt);
+  jlong wait_time = os::javaTimeNanos() - SafepointTracing::start_of_safepoint();
+  ls.print("Last thread to reach safepoint: \"%s\" after " JLONG_FORMAT " ns",
+           thread->get_thread_name(), wait_time);
+  if (thread->has_last_Java_frame()) {
+    frame fr = thread->last_frame();
+    if (fr.is_interpreted_frame()) {
+      ls.print(", interpreted at %s bci %d",
+               fr.interpreter_frame_method()->name_and_sig_as_C_string(),
+               fr.interpreter_frame_bci());
+    } else if (fr.is_compiled_frame()) {
+      CompiledMethod* cm = fr.cb()->as_compiled_method();
+      ls.print(", compiled at %s pc offset " INTX_FORMAT,
+               cm->method()->name_and_sig_as_C_string(),
+               (intx)(fr.pc() - cm->code_begin()));
+    }
+  }
+  ls.cr();
+}
+
 // Roll all threads forward to a safepoint and suspend them all
 void SafepointSynchronize::begin() {
   assert(Thread::current()->is_VM_thread(), "Only VM thread may execute a safepoint");
@@ -377,9 +413,14 @@ void SafepointSynchronize::begin() {
   arm_safepoint();
 
   // Will spin until all threads are safe.
-  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
+  JavaThread* last_running = NULL;
+  int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running, &last_running);
   assert(_waiting_to_block == 0, "No thread should be running");
 
+  if (last_running != NULL) {
+    log_last_running_thread(last_running);
+  }
+
 #ifndef PRODUCT
   // Mark all threads
   if (VerifyCrossModifyFence) {
@@ -422,7 +463,7 @@ void SafepointSynchronize::begin() {
   post_safepoint_synchronize_event(sync_event,
                                    _safepoint_id,
                                    initial_running,
-                                   _waiting_to_block, iterations);
+                                   _waiting_to_block, iterations, last_running);
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
@@ -121,6 +121,11 @@ StubCodeMark::~StubCodeMark() {
   assert(StubCodeDesc::_list == _cdesc, "expected order on list");
   _cgen->stub_epilog(_cdesc);
   Forte::register_stub(_cdesc->name(), _cdesc->begin(), _cdesc->end());
+#ifdef LINUX
+  if (WritePerfMap) {
+    CodeCache::write_perf_map_entry(_cdesc->name(), _cdesc->begin(), _cdesc->end());
+  }
+#endif
 
   if (JvmtiExport::should_post_dynamic_code_generated()) {
     JvmtiExport::post_dynamic_code_generated(_cdesc->name(), _cdesc->begin(), _cdesc->end());
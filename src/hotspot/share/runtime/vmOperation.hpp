@@ -90,6 +90,7 @@
   template(ShenandoahFinalUpdateRefs)             \
   template(ShenandoahFinalRoots)                  \
   template(ShenandoahDegeneratedGC)               \
+  template(EpsilonCollect)                        \
   template(Exit)                                  \
   template(LinuxDllLoad)                          \
   template(RotateGCLog)                           \
@@ -101,6 +102,7 @@
   template(DumpTouchedMethods)                    \
   template(CleanClassLoaderDataMetaspaces)        \
   template(PrintCompileQueue)                     \
+  template(PrintHotMethods)                       \
   template(PrintClassHierarchy)                   \
   template(ThreadSuspend)                         \
   template(ThreadsSuspendJVMTI)                   \
@@ -493,6 +493,10 @@ void VM_PrintCompileQueue::doit() {
   CompileBroker::print_compile_queues(_out);
 }
 
+void VM_PrintHotMethods::doit() {
+  CompileBroker::print_hot_methods(_out, _count);
+}
+
 #if INCLUDE_SERVICES
 void VM_PrintClassHierarchy::doit() {
   KlassHierarchy::print_class_hierarchy(_out, _print_interfaces, _print_subclasses, _classname);
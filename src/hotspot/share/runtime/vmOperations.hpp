@@ -270,6 +270,17 @@ class VM_PrintCompileQueue: public VM_Operation {
   void doit();
 };
 
+class VM_PrintHotMethods: public VM_Operation {
+ private:
+  outputStream* _out;
+  int _count;
+
+ public:
+  VM_PrintHotMethods(outputStream* st, int count) : _out(st), _count(count) {}
+  VMOp_Type type() const { return VMOp_PrintHotMethods; }
+  void doit();
+};
+
 #if INCLUDE_SERVICES
 class VM_PrintClassHierarchy: public VM_Operation {
  private:
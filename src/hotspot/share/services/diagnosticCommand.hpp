@@ -243,6 +243,22 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class VMLockStatsDCmd : public DCmd {
+public:
+  VMLockStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.lock_stats"; }
+  static const char* description() {
+    return "Print acquisition and contention statistics of the global VM locks.";
+  }
+  static const char* impact() { return "Low"; }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class SystemGCDCmd : public DCmd {
 public:
   SystemGCDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -578,6 +594,28 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class CompilerHotMethodsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _count;
+public:
+  CompilerHotMethodsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.hotmethods";
+  }
+  static const char* description() {
+    return "Print the methods with the highest invocation and backedge counts.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of loaded methods. Iterates all methods at a safepoint.";
+  }
+  static const JavaPermission permission() {
+    JavaPermission p = {"java.lang.management.ManagementPermission",
+                        "monitor", NULL};
+    return p;
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 #ifdef LINUX
 class PerfMapDCmd : public DCmd {
 public:
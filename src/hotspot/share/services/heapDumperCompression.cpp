@@ -30,11 +30,16 @@
 #include "runtime/thread.inline.hpp"
 #include "services/heapDumperCompression.hpp"
 
-
 char const* FileWriter::open_writer() {
   assert(_fd < 0, "Must not already be open");
 
-  _fd = os::create_binary_file(_path, false);    // don't replace existing file
+  if (os::is_fifo(_path)) {
+    // Stream the dump to the process reading from the named pipe. This
+    // blocks until the pipe has been opened for reading.
+    _fd = os::open(_path, O_WRONLY, 0);
+  } else {
+    _fd = os::create_binary_file(_path, false);    // don't replace existing file
+  }
 
   if (_fd < 0) {
     return os::strerror(errno);
@@ -54,10 +59,16 @@ char const* FileWriter::write_buf(char* buf, ssize_t size) {
   assert(_fd >= 0, "Must be open");
   assert(size > 0, "Must write at least one byte");
 
-  ssize_t n = (ssize_t) os::write(_fd, buf, (uint) size);
+  // Writes to a pipe may be partial.
+  while (size > 0) {
+    ssize_t n = (ssize_t) os::write(_fd, buf, (uint) size);
 
-  if (n <= 0) {
-    return os::strerror(errno);
+    if (n <= 0) {
+      return os::strerror(errno);
+    }
+
+    buf += n;
+    size -= n;
   }
 
   return NULL;
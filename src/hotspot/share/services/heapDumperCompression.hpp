@@ -57,7 +57,8 @@ public:
 };
 
 
-// A writer for a file.
+// A writer for a file. If the path names an existing named pipe, the dump
+// is written to the pipe instead of a new file.
 class FileWriter : public AbstractWriter {
 private:
   char const* _path;
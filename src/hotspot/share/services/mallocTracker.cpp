@@ -60,13 +60,24 @@ size_t MemoryCounter::peak_size() const {
 }
 #endif
 
+size_t MallocMemorySnapshot::malloc_overhead() const {
+  size_t count = 0;
+  for (int index = 0; index < mt_number_of_types; index ++) {
+    // Thread stacks may be accounted as mallocs (see ThreadStackTracker),
+    // but are not malloc'd and carry no header.
+    if (NMTUtil::index_to_flag(index) == mtThreadStack) continue;
+    count += _malloc[index].malloc_count();
+  }
+  return count * sizeof(MallocHeader);
+}
+
 // Total malloc'd memory amount
 size_t MallocMemorySnapshot::total() const {
   size_t amount = 0;
   for (int index = 0; index < mt_number_of_types; index ++) {
     amount += _malloc[index].malloc_size();
   }
-  amount += _tracking_header.size() + total_arena();
+  amount += malloc_overhead() + total_arena();
   return amount;
 }
 
@@ -84,7 +95,7 @@ size_t MallocMemorySnapshot::total_arena() const {
 void MallocMemorySnapshot::make_adjustment() {
   size_t arena_size = total_arena();
   int chunk_idx = NMTUtil::flag_to_index(mtChunk);
-  _malloc[chunk_idx].record_free(arena_size);
+  _malloc[chunk_idx].adjust_malloc_size(-(ssize_t)arena_size);
 }
 
 
@@ -99,7 +110,6 @@ void MallocHeader::release() const {
   if (MemTracker::tracking_level() <= NMT_minimal) return;
 
   MallocMemorySummary::record_free(size(), flags());
-  MallocMemorySummary::record_free_malloc_header(sizeof(MallocHeader));
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::deallocation_at(size(), _bucket_idx, _pos_idx);
   }
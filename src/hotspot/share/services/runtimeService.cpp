@@ -38,6 +38,8 @@ PerfCounter*  RuntimeService::_sync_time_ticks = NULL;
 PerfCounter*  RuntimeService::_total_safepoints = NULL;
 PerfCounter*  RuntimeService::_safepoint_time_ticks = NULL;
 PerfCounter*  RuntimeService::_application_time_ticks = NULL;
+PerfHistogram* RuntimeService::_sync_time_histogram = NULL;
+PerfHistogram* RuntimeService::_safepoint_time_histogram = NULL;
 
 void RuntimeService::init() {
   if (UsePerfData) {
@@ -59,6 +61,11 @@ void RuntimeService::init() {
               PerfDataManager::create_counter(SUN_RT, "applicationTime",
                                               PerfData::U_Ticks, CHECK);
 
+    _sync_time_histogram =
+              PerfHistogram::create(SUN_RT, "safepointSyncTimeHistogram", CHECK);
+
+    _safepoint_time_histogram =
+              PerfHistogram::create(SUN_RT, "safepointTimeHistogram", CHECK);
 
     // create performance counters for jvm_version and its capabilities
     PerfDataManager::create_constant(SUN_RT, "jvmVersion", PerfData::U_None,
@@ -91,6 +98,7 @@ void RuntimeService::record_safepoint_begin(jlong app_ticks) {
 void RuntimeService::record_safepoint_synchronized(jlong sync_ticks) {
   if (UsePerfData) {
     _sync_time_ticks->inc(sync_ticks);
+    _sync_time_histogram->record((jlong)(TimeHelper::counter_to_millis(sync_ticks) * 1000.0));
   }
 }
 
@@ -98,6 +106,7 @@ void RuntimeService::record_safepoint_end(jlong safepoint_ticks) {
   HS_PRIVATE_SAFEPOINT_END();
   if (UsePerfData) {
     _safepoint_time_ticks->inc(safepoint_ticks);
+    _safepoint_time_histogram->record((jlong)(TimeHelper::counter_to_millis(safepoint_ticks) * 1000.0));
   }
 }
 
@@ -34,6 +34,8 @@ private:
   static PerfCounter* _total_safepoints;
   static PerfCounter* _safepoint_time_ticks;   // Accumulated time at safepoints
   static PerfCounter* _application_time_ticks; // Accumulated time not at safepoints
+  static PerfHistogram* _sync_time_histogram;      // Distribution of safepoint sync times in us
+  static PerfHistogram* _safepoint_time_histogram; // Distribution of safepoint times in us
 
 public:
   static void init();
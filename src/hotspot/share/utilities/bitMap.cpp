@@ -628,12 +628,23 @@ void BitMap::clear_large() {
 }
 
 BitMap::idx_t BitMap::count_one_bits_in_range_of_words(idx_t beg_full_word, idx_t end_full_word) const {
-  idx_t sum = 0;
-  for (idx_t i = beg_full_word; i < end_full_word; i++) {
-    bm_word_t w = map()[i];
-    sum += population_count(w);
-  }
-  return sum;
+  // Use independent partial sums so that the population counts of
+  // consecutive words do not form a single dependency chain.
+  idx_t sum0 = 0;
+  idx_t sum1 = 0;
+  idx_t sum2 = 0;
+  idx_t sum3 = 0;
+  idx_t i = beg_full_word;
+  for (; (i + 4) <= end_full_word; i += 4) {
+    sum0 += population_count(map()[i]);
+    sum1 += population_count(map()[i + 1]);
+    sum2 += population_count(map()[i + 2]);
+    sum3 += population_count(map()[i + 3]);
+  }
+  for (; i < end_full_word; i++) {
+    sum0 += population_count(map()[i]);
+  }
+  return sum0 + sum1 + sum2 + sum3;
 }
 
 BitMap::idx_t BitMap::count_one_bits_within_word(idx_t beg, idx_t end) const {
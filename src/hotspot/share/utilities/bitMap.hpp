@@ -246,6 +246,9 @@ class BitMap {
   inline void set_bit(idx_t bit);
   inline void clear_bit(idx_t bit);
 
+  // Prefetch the word containing the specified bit for a later update.
+  inline void prefetch(idx_t bit) const;
+
   // Attempts to change a bit to a desired value. The operation returns true if
   // this thread changed the value of the bit. It was changed with a RMW operation
   // using the specified memory_order. The operation returns false if the change
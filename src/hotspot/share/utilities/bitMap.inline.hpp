@@ -28,6 +28,7 @@
 #include "utilities/bitMap.hpp"
 
 #include "runtime/atomic.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/align.hpp"
 #include "utilities/count_trailing_zeros.hpp"
 
@@ -41,6 +42,11 @@ inline void BitMap::clear_bit(idx_t bit) {
   *word_addr(bit) &= ~bit_mask(bit);
 }
 
+inline void BitMap::prefetch(idx_t bit) const {
+  verify_index(bit);
+  Prefetch::write((void*)word_addr(bit), 0);
+}
+
 inline const BitMap::bm_word_t BitMap::load_word_ordered(const volatile bm_word_t* const addr, atomic_memory_order memory_order) {
   if (memory_order == memory_order_relaxed || memory_order == memory_order_release) {
     return Atomic::load(addr);
@@ -213,6 +219,17 @@ inline BitMap::idx_t BitMap::get_next_bit_impl(idx_t l_index, idx_t r_index) con
         ? to_words_align_down(r_index) // Miniscule savings when aligned.
         : to_words_align_up(r_index);
       while (++index < limit) {
+        // Sparse ranges are common, so while far enough from the limit test
+        // a group of words with a single branch before looking at them one
+        // by one.
+        while ((index + 4) <= limit &&
+               ((map(index) ^ flip) | (map(index + 1) ^ flip) |
+                (map(index + 2) ^ flip) | (map(index + 3) ^ flip)) == 0) {
+          index += 4;
+        }
+        if (index >= limit) {
+          break;
+        }
         cword = map(index) ^ flip;
         if (cword != 0) {
           idx_t result = bit_index(index) + count_trailing_zeros(cword);
@@ -77,7 +77,7 @@ class ConcurrentHashTable<CONFIG, F>::BucketsOperation {
 
   // Returns false if all ranges are claimed.
   bool have_more_work() {
-    return Atomic::load_acquire(&_next_to_claim) >= _stop_task;
+    return Atomic::load_acquire(&_next_to_claim) < _stop_task;
   }
 
   void thread_owns_resize_lock(Thread* thread) {
@@ -181,6 +181,9 @@ class ConcurrentHashTable<CONFIG, F>::GrowTask :
   }
 
   // Re-sizes a portion of the table. Returns true if there is more work.
+  // Ranges are claimed atomically and every bucket is locked while it is
+  // split, so several threads may call this concurrently between prepare()
+  // and done(), which must be called by the thread that prepared the task.
   bool do_task(Thread* thread) {
     size_t start, stop;
     assert(BucketsOperation::_cht->_resize_lock_owner != NULL,
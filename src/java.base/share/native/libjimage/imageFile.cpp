@@ -558,10 +558,13 @@ void ImageFileReader::get_resource(ImageLocation& location, u1* uncompressed_dat
         if (!memory_map_image) {
                 delete[] compressed_data;
         }
-    } else {
+    } else if (!memory_map_image) {
         // Read bytes from offset beyond the image index.
         bool is_read = read_at(uncompressed_data, uncompressed_size, _index_size + offset);
         assert(is_read && "error reading from image or short read");
+    } else {
+        // Copy bytes from the mapped image.
+        memcpy(uncompressed_data, get_data_address() + offset, (size_t)uncompressed_size);
     }
 }
 
@@ -31,6 +31,7 @@
 
 #if defined(__linux__)
 #include <sys/sendfile.h>
+#include <dlfcn.h>
 #elif defined(_AIX)
 #include <string.h>
 #include <sys/socket.h>
@@ -52,11 +53,22 @@
 
 static jfieldID chan_fd;        /* jobject 'fd' in sun.nio.ch.FileChannelImpl */
 
+#if defined(__linux__)
+typedef ssize_t copy_file_range_func(int, loff_t*, int, loff_t*, size_t,
+                                     unsigned int);
+static copy_file_range_func* my_copy_file_range_func = NULL;
+#endif
+
 JNIEXPORT jlong JNICALL
 Java_sun_nio_ch_FileChannelImpl_initIDs(JNIEnv *env, jclass clazz)
 {
     jlong pageSize = sysconf(_SC_PAGESIZE);
     chan_fd = (*env)->GetFieldID(env, clazz, "fd", "Ljava/io/FileDescriptor;");
+#if defined(__linux__)
+    // copy_file_range() is only available with glibc 2.27 and later
+    my_copy_file_range_func =
+        (copy_file_range_func*) dlsym(RTLD_DEFAULT, "copy_file_range");
+#endif
     return pageSize;
 }
 
@@ -169,7 +181,38 @@ Java_sun_nio_ch_FileChannelImpl_transferTo0(JNIEnv *env, jobject this,
 
 #if defined(__linux__)
     off64_t offset = (off64_t)position;
-    jlong n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
+    jlong n;
+
+    // For file-to-file transfers copy_file_range() lets the kernel copy the
+    // data without reading it, or share the extents on file systems that
+    // support reflinks. The destination offset is the current file position,
+    // as with sendfile(). Destinations it does not handle (sockets, pipes,
+    // files opened for append, other file systems on older kernels) make it
+    // fail without side effects, in which case sendfile() is used instead.
+    if (my_copy_file_range_func != NULL) {
+        n = my_copy_file_range_func(srcFD, &offset, dstFD, NULL,
+                                    (size_t)count, 0);
+        if (n >= 0)
+            return n;
+        switch (errno) {
+            case EINTR:
+                return IOS_INTERRUPTED;
+            case EINVAL:
+            case ENOSYS:
+            case EXDEV:
+            case EBADF:
+            case EOPNOTSUPP:
+            case ETXTBSY:
+                // try sendfile()
+                offset = (off64_t)position;
+                break;
+            default:
+                JNU_ThrowIOExceptionWithLastError(env, "Copy failed");
+                return IOS_THROWN;
+        }
+    }
+
+    n = sendfile64(dstFD, srcFD, &offset, (size_t)count);
     if (n < 0) {
         if (errno == EAGAIN)
             return IOS_UNAVAILABLE;
@@ -33,6 +33,11 @@
 #include "ByteGray.h"
 #include "ByteIndexed.h"
 
+#ifdef __SSE2__
+#include <string.h>
+#include <emmintrin.h>
+#endif
+
 /*
  * This file declares, registers, and defines the various graphics
  * primitive loops to manipulate surfaces of type "IntArgbPre".
@@ -61,6 +66,9 @@ DECLARE_XPAR_BLITBG(ByteIndexedBm, IntArgbPre);
 DECLARE_XOR_BLIT(IntArgb, IntArgbPre);
 DECLARE_SRC_MASKFILL(IntArgbPre);
 DECLARE_SRCOVER_MASKFILL(IntArgbPre);
+#ifdef __SSE2__
+MaskFillFunc IntArgbPreSrcOverMaskFillSSE2;
+#endif
 DECLARE_ALPHA_MASKFILL(IntArgbPre);
 DECLARE_SRCOVER_MASKBLIT(IntArgb, IntArgbPre);
 DECLARE_ALPHA_MASKBLIT(IntArgb, IntArgbPre);
@@ -93,7 +101,12 @@ NativePrimitive IntArgbPrePrimitives[] = {
 
     REGISTER_XOR_BLIT(IntArgb, IntArgbPre),
     REGISTER_SRC_MASKFILL(IntArgbPre),
+#ifdef __SSE2__
+    REGISTER_MASKFILL(AnyColor, SrcOver, IntArgbPre,
+                      IntArgbPreSrcOverMaskFillSSE2),
+#else
     REGISTER_SRCOVER_MASKFILL(IntArgbPre),
+#endif
     REGISTER_ALPHA_MASKFILL(IntArgbPre),
     REGISTER_SRCOVER_MASKBLIT(IntArgb, IntArgbPre),
     REGISTER_ALPHA_MASKBLIT(IntArgb, IntArgbPre),
@@ -161,6 +174,128 @@ DEFINE_SRC_MASKFILL(IntArgbPre, 4ByteArgb)
 
 DEFINE_SRCOVER_MASKFILL(IntArgbPre, 4ByteArgb)
 
+#ifdef __SSE2__
+/*
+ * For a premultiplied destination the SrcOver MaskFill treats all four
+ * components of a pixel alike:
+ *
+ *     res = MUL8(pathA, src) + MUL8(0xff - MUL8(pathA, srcA), dst)
+ *
+ * which the loop below evaluates for 4 pixels at a time in 16-bit lanes.
+ * MUL8(a, b) is computed as (p + 128 + ((p + 128) >> 8)) >> 8 with p = a * b,
+ * which yields exactly the values of mul8table, so the results are identical
+ * to those of the generic IntArgbPreSrcOverMaskFill loop.
+ */
+static __m128i Mul8x8(__m128i a, __m128i b)
+{
+    __m128i p = _mm_add_epi16(_mm_mullo_epi16(a, b), _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(p, _mm_srli_epi16(p, 8)), 8);
+}
+
+static juint SrcOverPixel(juint src, jint srcA, jint pathA, juint dst)
+{
+    jint dstF = 0xff - MUL8(pathA, srcA);
+    juint res = 0;
+    jint shift;
+    for (shift = 0; shift < 32; shift += 8) {
+        jint s = (src >> shift) & 0xff;
+        jint d = (dst >> shift) & 0xff;
+        res |= ((juint) (MUL8(pathA, s) + MUL8(dstF, d))) << shift;
+    }
+    return res;
+}
+
+void IntArgbPreSrcOverMaskFillSSE2
+    (void *rasBase,
+     jubyte *pMask, jint maskOff, jint maskScan,
+     jint width, jint height,
+     jint fgColor,
+     SurfaceDataRasInfo *pRasInfo,
+     NativePrimitive *pPrim,
+     CompositeInfo *pCompInfo)
+{
+    jint srcA = ((juint) fgColor) >> 24;
+    jint srcR = (fgColor >> 16) & 0xff;
+    jint srcG = (fgColor >>  8) & 0xff;
+    jint srcB = (fgColor      ) & 0xff;
+    jint rasScan = pRasInfo->scanStride;
+    juint srcPix;
+    __m128i vZero = _mm_setzero_si128();
+    __m128i vFF = _mm_set1_epi16(0xff);
+    __m128i vSrcPix, vSrc, vSrcA;
+
+    if (srcA != 0xff) {
+        if (srcA == 0) {
+            return;
+        }
+        srcR = MUL8(srcA, srcR);
+        srcG = MUL8(srcA, srcG);
+        srcB = MUL8(srcA, srcB);
+    }
+    srcPix = (((juint) srcA) << 24) | (srcR << 16) | (srcG << 8) | srcB;
+    vSrcPix = _mm_set1_epi32((jint) srcPix);
+    vSrc = _mm_unpacklo_epi8(vSrcPix, vZero);
+    vSrcA = _mm_set1_epi16((short) srcA);
+
+    if (pMask) {
+        pMask += maskOff;
+    }
+    do {
+        juint *pRas = (juint *) rasBase;
+        jint x = 0;
+        if (pMask) {
+            for (; x + 4 <= width; x += 4) {
+                juint m4;
+                __m128i vMask, vMLo, vMHi, vDst, vLo, vHi;
+                memcpy(&m4, pMask + x, sizeof(m4));
+                if (m4 == 0) {
+                    continue;
+                }
+                if (m4 == 0xffffffff && srcA == 0xff) {
+                    _mm_storeu_si128((__m128i *) (pRas + x), vSrcPix);
+                    continue;
+                }
+                /* Replicate every mask byte over the 4 bytes of its pixel */
+                vMask = _mm_cvtsi32_si128((jint) m4);
+                vMask = _mm_unpacklo_epi8(vMask, vMask);
+                vMask = _mm_unpacklo_epi16(vMask, vMask);
+                vMLo = _mm_unpacklo_epi8(vMask, vZero);
+                vMHi = _mm_unpackhi_epi8(vMask, vZero);
+                vDst = _mm_loadu_si128((__m128i *) (pRas + x));
+                vLo = _mm_add_epi16(Mul8x8(vMLo, vSrc),
+                                    Mul8x8(_mm_sub_epi16(vFF, Mul8x8(vMLo, vSrcA)),
+                                           _mm_unpacklo_epi8(vDst, vZero)));
+                vHi = _mm_add_epi16(Mul8x8(vMHi, vSrc),
+                                    Mul8x8(_mm_sub_epi16(vFF, Mul8x8(vMHi, vSrcA)),
+                                           _mm_unpackhi_epi8(vDst, vZero)));
+                _mm_storeu_si128((__m128i *) (pRas + x),
+                                 _mm_packus_epi16(vLo, vHi));
+            }
+            for (; x < width; x++) {
+                jint pathA = pMask[x];
+                if (pathA > 0) {
+                    pRas[x] = SrcOverPixel(srcPix, srcA, pathA, pRas[x]);
+                }
+            }
+            pMask = PtrAddBytes(pMask, maskScan);
+        } else {
+            __m128i vDstF = _mm_set1_epi16((short) (0xff - srcA));
+            for (; x + 4 <= width; x += 4) {
+                __m128i vDst = _mm_loadu_si128((__m128i *) (pRas + x));
+                __m128i vLo = Mul8x8(vDstF, _mm_unpacklo_epi8(vDst, vZero));
+                __m128i vHi = Mul8x8(vDstF, _mm_unpackhi_epi8(vDst, vZero));
+                _mm_storeu_si128((__m128i *) (pRas + x),
+                                 _mm_add_epi8(vSrcPix, _mm_packus_epi16(vLo, vHi)));
+            }
+            for (; x < width; x++) {
+                pRas[x] = SrcOverPixel(srcPix, srcA, 0xff, pRas[x]);
+            }
+        }
+        rasBase = PtrAddBytes(rasBase, rasScan);
+    } while (--height > 0);
+}
+#endif /* __SSE2__ */
+
 DEFINE_ALPHA_MASKFILL(IntArgbPre, 4ByteArgb)
 
 DEFINE_SRCOVER_MASKBLIT(IntArgb, IntArgbPre, 4ByteArgb)
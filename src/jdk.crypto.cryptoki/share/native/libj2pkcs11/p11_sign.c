@@ -118,6 +118,7 @@ JNIEXPORT jbyteArray JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Sign
     CK_ULONG ckDataLength;
     CK_BYTE_PTR bufP;
     CK_ULONG ckSignatureLength;
+    CK_BYTE INBUF[MAX_STACK_BUFFER_LEN];
     CK_BYTE BUF[MAX_STACK_BUFFER_LEN];
     jbyteArray jSignature = NULL;
     CK_RV rv;
@@ -128,7 +129,14 @@ JNIEXPORT jbyteArray JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Sign
     TRACE0("DEBUG: C_Sign\n");
 
     ckSessionHandle = jLongToCKULong(jSessionHandle);
-    jByteArrayToCKByteArray(env, jData, &ckpData, &ckDataLength);
+    // the data is usually a digest, copy it to the stack to save the malloc
+    if (jData != NULL && (*env)->GetArrayLength(env, jData) <= MAX_STACK_BUFFER_LEN) {
+        ckDataLength = (*env)->GetArrayLength(env, jData);
+        ckpData = INBUF;
+        (*env)->GetByteArrayRegion(env, jData, 0, ckDataLength, (jbyte *)ckpData);
+    } else {
+        jByteArrayToCKByteArray(env, jData, &ckpData, &ckDataLength);
+    }
     if ((*env)->ExceptionCheck(env)) {
         return NULL;
     }
@@ -149,7 +157,7 @@ JNIEXPORT jbyteArray JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Sign
         TRACE1("DEBUG C_Sign: signature length = %lu\n", ckSignatureLength);
     }
 
-    free(ckpData);
+    if (ckpData != INBUF) { free(ckpData); }
     if (bufP != BUF) { free(bufP); }
 
     TRACE0("FINISHED\n");
@@ -440,6 +448,7 @@ JNIEXPORT void JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Verify
     CK_BYTE_PTR ckpSignature = NULL_PTR;
     CK_ULONG ckDataLength;
     CK_ULONG ckSignatureLength;
+    CK_BYTE INBUF[MAX_STACK_BUFFER_LEN];
     CK_RV rv = 0;
 
     CK_FUNCTION_LIST_PTR ckpFunctions = getFunctionList(env, obj);
@@ -447,9 +456,16 @@ JNIEXPORT void JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Verify
 
     ckSessionHandle = jLongToCKULong(jSessionHandle);
 
-    jByteArrayToCKByteArray(env, jData, &ckpData, &ckDataLength);
+    // the data is usually a digest, copy it to the stack to save the malloc
+    if (jData != NULL && (*env)->GetArrayLength(env, jData) <= MAX_STACK_BUFFER_LEN) {
+        ckDataLength = (*env)->GetArrayLength(env, jData);
+        ckpData = INBUF;
+        (*env)->GetByteArrayRegion(env, jData, 0, ckDataLength, (jbyte *)ckpData);
+    } else {
+        jByteArrayToCKByteArray(env, jData, &ckpData, &ckDataLength);
+    }
     if ((*env)->ExceptionCheck(env)) {
-        return;
+        goto cleanup;
     }
 
     jByteArrayToCKByteArray(env, jSignature, &ckpSignature, &ckSignatureLength);
@@ -461,7 +477,7 @@ JNIEXPORT void JNICALL Java_sun_security_pkcs11_wrapper_PKCS11_C_1Verify
     rv = (*ckpFunctions->C_Verify)(ckSessionHandle, ckpData, ckDataLength, ckpSignature, ckSignatureLength);
 
 cleanup:
-    free(ckpData);
+    if (ckpData != INBUF) { free(ckpData); }
     free(ckpSignature);
 
     ckAssertReturnValueOK(env, rv);
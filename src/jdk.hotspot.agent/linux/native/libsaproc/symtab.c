@@ -46,8 +46,53 @@ typedef struct symtab {
   size_t num_symbols;
   struct elf_symbol *symbols;
   struct hsearch_data *hash_table;
+  // symbols with a name and a non-zero size, sorted by offset, used by
+  // nearest_symbol(); max_size is the largest size of these symbols
+  struct elf_symbol **sorted;
+  size_t num_sorted;
+  uintptr_t max_size;
 } symtab_t;
 
+static int compare_symbol_offset(const void *p1, const void *p2) {
+  const struct elf_symbol *sym1 = *(const struct elf_symbol **)p1;
+  const struct elf_symbol *sym2 = *(const struct elf_symbol **)p2;
+  if (sym1->offset != sym2->offset) {
+    return sym1->offset < sym2->offset ? -1 : 1;
+  }
+  // keep symbol table order for symbols at the same offset
+  return sym1 < sym2 ? -1 : (sym1 > sym2 ? 1 : 0);
+}
+
+// Build the offset-sorted index of the symbols. If the index cannot be
+// allocated nearest_symbol() falls back to a linear search.
+static void build_sorted_index(struct symtab *symtab) {
+  size_t n, count = 0;
+
+  for (n = 0; n < symtab->num_symbols; n++) {
+    if (symtab->symbols[n].name != NULL && symtab->symbols[n].size > 0) {
+      count++;
+    }
+  }
+  if (count == 0) {
+    return;
+  }
+  symtab->sorted = (struct elf_symbol **)malloc(count * sizeof(struct elf_symbol *));
+  if (symtab->sorted == NULL) {
+    return;
+  }
+  for (n = 0; n < symtab->num_symbols; n++) {
+    struct elf_symbol *sym = &(symtab->symbols[n]);
+    if (sym->name != NULL && sym->size > 0) {
+      symtab->sorted[symtab->num_sorted++] = sym;
+      if (sym->size > symtab->max_size) {
+        symtab->max_size = sym->size;
+      }
+    }
+  }
+  qsort(symtab->sorted, symtab->num_sorted, sizeof(struct elf_symbol *),
+        compare_symbol_offset);
+}
+
 
 // Directory that contains global debuginfo files.  In theory it
 // should be possible to change this, but in a Java environment there
@@ -445,6 +490,8 @@ static struct symtab* build_symtab_internal(int fd, const char *filename, bool t
         item.data = (void *)&(symtab->symbols[j]);
         hsearch_r(item, ENTER, &ret, symtab->hash_table);
       }
+
+      build_sorted_index(symtab);
     }
   }
 
@@ -523,6 +570,7 @@ void destroy_symtab(struct symtab* symtab) {
   if (!symtab) return;
   if (symtab->strs) free(symtab->strs);
   if (symtab->symbols) free(symtab->symbols);
+  if (symtab->sorted) free(symtab->sorted);
   if (symtab->hash_table) {
      hdestroy_r(symtab->hash_table);
      free(symtab->hash_table);
@@ -559,6 +607,34 @@ const char* nearest_symbol(struct symtab* symtab, uintptr_t offset,
                            uintptr_t* poffset) {
   int n = 0;
   if (!symtab) return NULL;
+  if (symtab->sorted != NULL) {
+    // Find the first symbol starting above offset, then look at the symbols
+    // before it that may still contain offset. Overlapping symbols are
+    // resolved to the one first in the symbol table, as in the linear
+    // search below.
+    struct elf_symbol* found = NULL;
+    size_t lo = 0;
+    size_t hi = symtab->num_sorted;
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      if (symtab->sorted[mid]->offset <= offset) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    while (lo > 0) {
+      struct elf_symbol* sym = symtab->sorted[--lo];
+      if (offset - sym->offset >= symtab->max_size) {
+        break;
+      }
+      if (offset < sym->offset + sym->size && (found == NULL || sym < found)) {
+        found = sym;
+      }
+    }
+    if (found != NULL && poffset) *poffset = (offset - found->offset);
+    return found != NULL ? found->name : NULL;
+  }
   for (; n < symtab->num_symbols; n++) {
      struct elf_symbol* sym = &(symtab->symbols[n]);
      if (sym->name != NULL &&
@@ -369,10 +369,15 @@ eventInstance(EventInfo *evinfo)
  *
  * If shouldDelete is returned true, a count filter has expired
  * and the corresponding node should be deleted.
+ *
+ * The name of the event class is only needed by ClassMatch and
+ * ClassExclude filters; it is looked up the first time such a filter
+ * is evaluated and stored in *pClassname, which must be NULL
+ * initially. The caller must free it with jvmtiDeallocate().
  */
 jboolean
 eventFilterRestricted_passesFilter(JNIEnv *env,
-                                   char *classname,
+                                   char **pClassname,
                                    EventInfo *evinfo,
                                    HandlerNode *node,
                                    jboolean *shouldDelete)
@@ -492,7 +497,10 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
                 break;
 
         case JDWP_REQUEST_MODIFIER(ClassMatch): {
-            if (!patternStringMatch(classname,
+            if (*pClassname == NULL) {
+                *pClassname = getClassname(clazz);
+            }
+            if (!patternStringMatch(*pClassname,
                        filter->u.ClassMatch.classPattern)) {
                 return JNI_FALSE;
             }
@@ -500,7 +508,10 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
         }
 
         case JDWP_REQUEST_MODIFIER(ClassExclude): {
-            if (patternStringMatch(classname,
+            if (*pClassname == NULL) {
+                *pClassname = getClassname(clazz);
+            }
+            if (patternStringMatch(*pClassname,
                       filter->u.ClassExclude.classPattern)) {
                 return JNI_FALSE;
             }
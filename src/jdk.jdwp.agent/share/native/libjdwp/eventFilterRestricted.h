@@ -38,7 +38,7 @@ jvmtiError eventFilterRestricted_install(HandlerNode *node);
 jvmtiError eventFilterRestricted_deinstall(HandlerNode *node);
 
 jboolean eventFilterRestricted_passesFilter(JNIEnv *env,
-                                            char *classname,
+                                            char **pClassname,
                                             EventInfo *evinfo,
                                             HandlerNode *node,
                                             jboolean *shouldDelete);
@@ -645,14 +645,15 @@ event_callback(JNIEnv *env, EventInfo *evinfo)
         }
 
         node = getHandlerChain(evinfo->ei)->first;
-        classname = getClassname(evinfo->clazz);
+        /* Looked up by the filters only if they need it */
+        classname = NULL;
 
         while (node != NULL) {
             /* save next so handlers can remove themselves */
             HandlerNode *next = NEXT(node);
             jboolean shouldDelete;
 
-            if (eventFilterRestricted_passesFilter(env, classname,
+            if (eventFilterRestricted_passesFilter(env, &classname,
                                                    evinfo, node,
                                                    &shouldDelete)) {
                 HandlerFunction func;
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardSet.inline.hpp"
+#include "runtime/mutex.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "unittest.hpp"
+
+class G1CardSetTest : public ::testing::Test {
+  uint _saved_cards_in_region;
+  uint _saved_max_cards_in_array;
+  uint _saved_max_bitmaps;
+  uint _saved_cards_in_bitmap_to_coarsen;
+
+public:
+  static const uint CardsInRegion = 1024;
+  static const uint MaxCardsInArray = 16;
+  static const uint MaxBitMaps = 2;
+  static const uint CardsInBitMapToCoarsen = 512;
+
+  void SetUp() {
+    _saved_cards_in_region = G1CardSet::_cards_in_region;
+    _saved_max_cards_in_array = G1CardSet::_max_cards_in_array;
+    _saved_max_bitmaps = G1CardSet::_max_bitmaps;
+    _saved_cards_in_bitmap_to_coarsen = G1CardSet::_cards_in_bitmap_to_coarsen;
+
+    G1CardSet::_cards_in_region = CardsInRegion;
+    G1CardSet::_max_cards_in_array = MaxCardsInArray;
+    G1CardSet::_max_bitmaps = MaxBitMaps;
+    G1CardSet::_cards_in_bitmap_to_coarsen = CardsInBitMapToCoarsen;
+  }
+
+  void TearDown() {
+    G1CardSet::_cards_in_region = _saved_cards_in_region;
+    G1CardSet::_max_cards_in_array = _saved_max_cards_in_array;
+    G1CardSet::_max_bitmaps = _saved_max_bitmaps;
+    G1CardSet::_cards_in_bitmap_to_coarsen = _saved_cards_in_bitmap_to_coarsen;
+  }
+};
+
+class G1CountContainersClosure {
+public:
+  uint _num_full;
+  uint _num_bitmap;
+  uint _num_array;
+  size_t _num_cards;
+
+  G1CountContainersClosure() : _num_full(0), _num_bitmap(0), _num_array(0), _num_cards(0) { }
+
+  void next_full_container(uint region_idx) {
+    _num_full++;
+    _num_cards += G1CardSetTest::CardsInRegion;
+  }
+
+  void next_bitmap_container(uint region_idx, BitMap* bm) {
+    _num_bitmap++;
+    _num_cards += bm->count_one_bits();
+  }
+
+  void next_array_container(uint region_idx, G1CardSet::card_elem_t* cards, uint num_cards) {
+    _num_array++;
+    _num_cards += num_cards;
+  }
+};
+
+TEST_VM_F(G1CardSetTest, add_and_contains) {
+  Mutex m(Mutex::leaf, "G1CardSetTest lock", true, Mutex::_safepoint_check_never);
+  G1CardSet card_set(&m);
+
+  ASSERT_TRUE(card_set.is_empty());
+
+  // Many regions with few cards each stay in array containers and make the
+  // table grow.
+  const uint num_regions = 100;
+  for (uint r = 0; r < num_regions; r++) {
+    for (uint c = 0; c < 3; c++) {
+      ASSERT_EQ(card_set.add_card(r, c * 7), G1CardSet::Added);
+    }
+    ASSERT_EQ(card_set.add_card(r, 7), G1CardSet::Found);
+  }
+  ASSERT_EQ(card_set.occupied(), (size_t)num_regions * 3);
+  ASSERT_EQ(card_set.num_entries(), num_regions);
+  ASSERT_EQ(card_set.num_array_containers(), num_regions);
+
+  for (uint r = 0; r < num_regions; r++) {
+    ASSERT_TRUE(card_set.contains_card(r, 0));
+    ASSERT_TRUE(card_set.contains_card(r, 14));
+    ASSERT_FALSE(card_set.contains_card(r, 1));
+  }
+  ASSERT_FALSE(card_set.contains_card(num_regions, 0));
+
+  G1CountContainersClosure cl;
+  card_set.iterate_containers(cl);
+  ASSERT_EQ(cl._num_array, num_regions);
+  ASSERT_EQ(cl._num_cards, (size_t)num_regions * 3);
+
+  card_set.clear();
+  ASSERT_TRUE(card_set.is_empty());
+  ASSERT_EQ(card_set.num_entries(), 0u);
+  ASSERT_FALSE(card_set.contains_card(0, 0));
+}
+
+TEST_VM_F(G1CardSetTest, container_transitions) {
+  Mutex m(Mutex::leaf, "G1CardSetTest lock", true, Mutex::_safepoint_check_never);
+  G1CardSet card_set(&m);
+
+  // Overflowing the array container converts it to a bitmap.
+  for (uint c = 0; c <= MaxCardsInArray; c++) {
+    ASSERT_EQ(card_set.add_card(0, c), G1CardSet::Added);
+  }
+  ASSERT_EQ(card_set.num_bitmap_containers(), 1u);
+  for (uint c = 0; c <= MaxCardsInArray; c++) {
+    ASSERT_TRUE(card_set.contains_card(0, c));
+  }
+  ASSERT_FALSE(card_set.contains_card(0, MaxCardsInArray + 1));
+
+  // Filling the bitmap container converts it to a full container.
+  for (uint c = 0; c < CardsInBitMapToCoarsen; c++) {
+    card_set.add_card(0, c);
+  }
+  ASSERT_EQ(card_set.num_bitmap_containers(), 0u);
+  ASSERT_EQ(card_set.num_full_containers(), 1u);
+  ASSERT_TRUE(card_set.contains_card(0, CardsInRegion - 1));
+  ASSERT_EQ(card_set.occupied(), (size_t)CardsInRegion);
+
+  // Exceeding the maximum number of bitmaps converts arrays directly to full
+  // containers.
+  for (uint r = 1; r <= MaxBitMaps + 1; r++) {
+    for (uint c = 0; c <= MaxCardsInArray; c++) {
+      card_set.add_card(r, c);
+    }
+  }
+  ASSERT_EQ(card_set.num_bitmap_containers(), MaxBitMaps);
+  ASSERT_EQ(card_set.num_full_containers(), 2u);
+  ASSERT_EQ(card_set.num_array_containers(), 0u);
+
+  G1CountContainersClosure cl;
+  card_set.iterate_containers(cl);
+  ASSERT_EQ(cl._num_full, 2u);
+  ASSERT_EQ(cl._num_bitmap, MaxBitMaps);
+  ASSERT_EQ(cl._num_array, 0u);
+  ASSERT_EQ(cl._num_cards, card_set.occupied());
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.inline.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "memory/allocation.inline.hpp"
+#include "utilities/bitMap.inline.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/ticks.hpp"
+
+#include "unittest.hpp"
+
+// Like test_oopStorage_parperf.cpp, these "tests" mostly serve as
+// microbenchmarks for some GC hot paths. Every benchmark is run a number of
+// times after some warmup runs, and the minimum, average and maximum time of
+// the measured runs is printed. They take too long to be part of the default
+// gtest run and are disabled; run them explicitly with e.g.
+//
+//   --gtest_also_run_disabled_tests --gtest_filter=GCHotPathsPerf.*
+
+class GCHotPathsPerf : public ::testing::Test {
+public:
+  static const uint WarmupRuns = 3;
+  static const uint MeasuredRuns = 10;
+
+  // Runs bench.run() repeatedly and prints statistics about the measured runs.
+  // The result of every run is accumulated and returned so that the
+  // benchmarked work can not be optimized away.
+  template <typename Bench>
+  static size_t measure(const char* name, Bench& bench) {
+    size_t result = 0;
+    for (uint i = 0; i < WarmupRuns; i++) {
+      result += bench.run();
+    }
+    Tickspan min_time;
+    Tickspan max_time;
+    Tickspan total_time;
+    for (uint i = 0; i < MeasuredRuns; i++) {
+      Ticks start = Ticks::now();
+      result += bench.run();
+      Tickspan t = Ticks::now() - start;
+      if (i == 0 || t < min_time) {
+        min_time = t;
+      }
+      if (t > max_time) {
+        max_time = t;
+      }
+      total_time += t;
+    }
+    tty->print_cr("%s: min " UINT64_FORMAT "us avg " UINT64_FORMAT "us max " UINT64_FORMAT "us (%u runs)",
+                  name,
+                  min_time.microseconds(),
+                  total_time.microseconds() / MeasuredRuns,
+                  max_time.microseconds(),
+                  MeasuredRuns);
+    return result;
+  }
+};
+
+class BitMapIterateBench {
+  CHeapBitMap _bm;
+
+public:
+  BitMapIterateBench(BitMap::idx_t size, BitMap::idx_t stride) : _bm(size, mtGC) {
+    for (BitMap::idx_t i = 0; i < size; i += stride) {
+      _bm.set_bit(i);
+    }
+  }
+
+  size_t run() {
+    size_t count = 0;
+    for (BitMap::idx_t i = _bm.get_next_one_offset(0);
+         i < _bm.size();
+         i = _bm.get_next_one_offset(i + 1)) {
+      count++;
+    }
+    return count;
+  }
+};
+
+TEST_VM_F(GCHotPathsPerf, DISABLED_bitmap_iterate) {
+  const BitMap::idx_t size = 64 * M;
+
+  BitMapIterateBench sparse(size, 4099);
+  size_t sparse_count = measure("BitMap iterate sparse", sparse);
+  ASSERT_EQ(sparse_count, (WarmupRuns + MeasuredRuns) * ((size + 4098) / 4099));
+
+  BitMapIterateBench dense(size, 3);
+  size_t dense_count = measure("BitMap iterate dense", dense);
+  ASSERT_EQ(dense_count, (WarmupRuns + MeasuredRuns) * ((size + 2) / 3));
+}
+
+class BitMapCountBench {
+  CHeapBitMap _bm;
+
+public:
+  BitMapCountBench(BitMap::idx_t size, BitMap::idx_t stride) : _bm(size, mtGC) {
+    for (BitMap::idx_t i = 0; i < size; i += stride) {
+      _bm.set_bit(i);
+    }
+  }
+
+  size_t run() {
+    // Start unaligned to also cover a partial word.
+    return _bm.count_one_bits(1, _bm.size());
+  }
+};
+
+TEST_VM_F(GCHotPathsPerf, DISABLED_bitmap_count) {
+  const BitMap::idx_t size = 64 * M;
+
+  BitMapCountBench bench(size, 3);
+  size_t count = measure("BitMap count_one_bits", bench);
+  // Bit 0 is set but excluded from the counted range.
+  ASSERT_EQ(count, (WarmupRuns + MeasuredRuns) * ((size + 2) / 3 - 1));
+}
+
+class TaskQueuePushPopBench {
+  typedef GenericTaskQueue<size_t, mtGC> Queue;
+
+  Queue _queue;
+  bool _steal;
+
+public:
+  TaskQueuePushPopBench(bool steal) : _steal(steal) {
+    _queue.initialize();
+  }
+
+  size_t run() {
+    const uint num_tasks = _queue.max_elems();
+    for (uint rounds = 0; rounds < 16; rounds++) {
+      for (size_t i = 0; i < num_tasks; i++) {
+        guarantee(_queue.push(i), "queue must not be full");
+      }
+      size_t t;
+      if (_steal) {
+        while (_queue.pop_global(t)) { }
+      } else {
+        while (_queue.pop_local(t)) { }
+      }
+    }
+    return _queue.size();
+  }
+};
+
+TEST_VM_F(GCHotPathsPerf, DISABLED_taskqueue_push_pop) {
+  TaskQueuePushPopBench local(false);
+  ASSERT_EQ(measure("TaskQueue push/pop_local", local), 0u);
+
+  TaskQueuePushPopBench global(true);
+  ASSERT_EQ(measure("TaskQueue push/pop_global", global), 0u);
+}
+
+class OopStorageAllocateReleaseBench {
+  static const size_t NumEntries = 100000;
+
+  OopStorage _storage;
+  oop** _entries;
+
+public:
+  OopStorageAllocateReleaseBench() :
+    _storage("GCHotPathsPerf Storage", mtGC),
+    _entries(NEW_C_HEAP_ARRAY(oop*, NumEntries, mtGC)) { }
+
+  ~OopStorageAllocateReleaseBench() {
+    FREE_C_HEAP_ARRAY(oop*, _entries);
+  }
+
+  size_t run() {
+    for (size_t i = 0; i < NumEntries; i++) {
+      _entries[i] = _storage.allocate();
+    }
+    // Release in reverse order, one at a time, as is common for handles.
+    for (size_t i = NumEntries; i > 0; i--) {
+      _storage.release(_entries[i - 1]);
+    }
+    return _storage.allocation_count();
+  }
+};
+
+TEST_VM_F(GCHotPathsPerf, DISABLED_oopstorage_allocate_release) {
+  OopStorageAllocateReleaseBench bench;
+  ASSERT_EQ(measure("OopStorage allocate/release", bench), 0u);
+}
@@ -41,7 +41,9 @@ TEST_VM(LogFileOutput, parse_valid) {
     "filesize=256,filecount=11",
     "filesize=0", "filecount=1",
     "filesize=1m", "filesize=1M",
-    "filesize=1k", "filesize=1G"
+    "filesize=1k", "filesize=1G",
+    "format=text", "format=json",
+    "filecount=2,format=json"
   };
 
   // Override LogOutput's vm_start time to get predictable file name
@@ -74,6 +76,7 @@ TEST_VM(LogFileOutput, parse_invalid) {
     "filecount= 2", "filesize=2 ",
     "filecount=ab", "filesize=0xz",
     "filecount=1MB", "filesize=99bytes",
+    "format=", "format=xml", "format=JSON",
     "filesize=9999999999999999999999999"
     "filecount=9999999999999999999999999"
   };
@@ -178,3 +181,33 @@ TEST_VM(LogFileOutput, invalid_file) {
     << "missing expected error message, received msg: %s" << ss.as_string();
   delete_empty_directory("tmplogdir");
 }
+
+TEST_VM(LogFileOutput, json_format) {
+  ResourceMark rm;
+  const char* filename = prepend_temp_dir("json-format-test");
+  delete_file(filename);
+
+  LogStreamHandle(Error, logging) stream;
+  bool success = LogConfiguration::parse_log_arguments(filename, "logging=debug", "level,tags", "format=json", &stream);
+  ASSERT_TRUE(success) << "Failed to configure JSON output to '" << filename << "'";
+  log_debug(logging)("json test: quote\" backslash\\ nl\n tab\t bell\a utf8 \xc3\xa9\xe2\x82\xac"
+                     " invalid \xff\xc3 overlong \xc0\xaf surrogate \xed\xa0\x80 end");
+  success = LogConfiguration::parse_log_arguments(filename, "all=off", "", "", &stream);
+  ASSERT_TRUE(success) << "Failed to disable logging to '" << filename << "'";
+  AsyncLogWriter::flush();
+
+  const char* expected =
+    "{\"level\":\"debug\",\"tags\":\"logging\",\"message\":\"json test: quote\\\" backslash\\\\ nl\\n tab\\t bell\\u0007"
+    " utf8 \xc3\xa9\xe2\x82\xac invalid \\u00ff\\u00c3 overlong \\u00c0\\u00af surrogate \\u00ed\\u00a0\\u0080 end\"}\n";
+
+  FILE* fp = os::fopen(filename, "r");
+  ASSERT_TRUE(fp != NULL) << "Could not open '" << filename << "'";
+  char* line = NULL;
+  // Skip the messages about the log configuration.
+  while ((line = read_line(fp)) != NULL && !string_contains_substring(line, "json test")) { }
+  fclose(fp);
+  ASSERT_TRUE(line != NULL) << "Message not found in '" << filename << "'";
+  EXPECT_STREQ(expected, line);
+
+  delete_file(filename);
+}
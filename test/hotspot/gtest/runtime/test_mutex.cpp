@@ -51,6 +51,21 @@ TEST_VM(MutexName, mutex_name) {
   }
 }
 
+TEST_VM(MutexStats, uncontended) {
+  Mutex* mutex = new Mutex(Mutex::leaf, "mutex_stats", true, Mutex::_safepoint_check_never);
+  for (int i = 0; i < iterations; i++) {
+    mutex->lock_without_safepoint_check();
+    mutex->unlock();
+  }
+  ASSERT_TRUE(mutex->try_lock());
+  ASSERT_FALSE(mutex->try_lock());
+  mutex->unlock();
+
+  ASSERT_EQ(mutex->acquisitions(), (uint64_t)iterations + 1);
+  ASSERT_EQ(mutex->contended_acquisitions(), 0u);
+  delete mutex;
+}
+
 #ifdef ASSERT
 
 const int rankA = 50;
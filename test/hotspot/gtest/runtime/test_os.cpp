@@ -540,6 +540,20 @@ TEST_VM(os, show_mappings_full_range) {
   }
 }
 
+TEST_VM(os, pretouch_memory) {
+  const size_t size = 4 * M;
+  char* p = os::reserve_memory(size, false, mtInternal);
+  ASSERT_NE(p, (char*)NULL);
+  ASSERT_TRUE(os::commit_memory(p, size, false));
+  // Unaligned bounds cover the pages they are in.
+  os::pretouch_memory(p + 1, p + size - 1);
+  os::pretouch_memory(p, p);
+  for (size_t i = 0; i < size; i += os::vm_page_size()) {
+    ASSERT_EQ(p[i], 0);
+  }
+  ASSERT_TRUE(os::release_memory(p, size));
+}
+
 #ifdef _WIN32
 // Test os::win32::find_mapping
 TEST_VM(os, find_mapping_simple) {
@@ -22,6 +22,8 @@
  */
 
 #include "precompiled.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/perfData.hpp"
 #include "runtime/perfMemory.hpp"
 #include "unittest.hpp"
 
@@ -41,3 +43,29 @@ TEST_VM_F(PerfMemoryTest, destroy) {
   ASSERT_NE(PerfMemory::capacity(), (size_t)0) << "PerfMemory::_capacity should not be 0";
 }
 
+
+TEST_VM(PerfHistogram, record) {
+  if (!UsePerfData) {
+    return;
+  }
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+
+  PerfHistogram* h = PerfHistogram::create(SUN_RT, "gtestHistogram", THREAD);
+  ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+  ASSERT_NE(h, (PerfHistogram*)NULL);
+
+  h->record(-1);
+  h->record(0);
+  h->record(1);
+  h->record(2);
+  h->record(3);
+  h->record(4);
+  h->record(max_jlong);
+
+  ASSERT_EQ(h->bucket_value(0), 2);
+  ASSERT_EQ(h->bucket_value(1), 1);
+  ASSERT_EQ(h->bucket_value(2), 2);
+  ASSERT_EQ(h->bucket_value(3), 1);
+  ASSERT_EQ(h->bucket_value(PerfHistogram::NumBuckets - 1), 1);
+}
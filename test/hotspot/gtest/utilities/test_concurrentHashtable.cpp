@@ -1130,3 +1130,63 @@ public:
 TEST_VM(ConcurrentHashTable, concurrent_mt_bulk_delete) {
   mt_test_doer<Driver_BD_Thread>();
 }
+
+//#############################################################################################
+
+class MT_GT_Thread : public JavaTestThread {
+  TestTable::GrowTask* _gt;
+  public:
+  MT_GT_Thread(Semaphore* post, TestTable::GrowTask* gt)
+    : JavaTestThread(post), _gt(gt){}
+  virtual ~MT_GT_Thread() {}
+  void main_run() {
+    while(_gt->do_task(this));
+  }
+};
+
+class Driver_GT_Thread : public JavaTestThread {
+public:
+  Driver_GT_Thread(Semaphore* post) : JavaTestThread(post) {
+  };
+  virtual ~Driver_GT_Thread(){}
+
+  void main_run() {
+    Semaphore done(0);
+    // Big enough for the grow to be split into several ranges.
+    TestTable* cht = new TestTable(14, 16, 2);
+    for (uintptr_t v = 1; v < 99999; v++ ) {
+      TestLookup tl(v);
+      EXPECT_TRUE(cht->insert(this, tl, v)) << "Inserting an unique value should work.";
+    }
+    TestTable::GrowTask gt(cht);
+    EXPECT_TRUE(gt.prepare(this)) << "Uncontended prepare must work.";
+
+    MT_GT_Thread* tt[4];
+    for (int i = 0; i < 4; i++) {
+      tt[i] = new MT_GT_Thread(&done, &gt);
+      tt[i]->doit();
+    }
+
+    for (uintptr_t v = 1; v < 99999; v++ ) {
+      TestLookup tl(v);
+      EXPECT_EQ(cht_get_copy(cht, this, tl), v) << "Getting an item during grow failed.";
+    }
+
+    for (int i = 0; i < 4; i++) {
+      done.wait();
+    }
+
+    gt.done(this);
+
+    EXPECT_EQ(cht->get_size_log2(this), (size_t)15) << "Table should have grown.";
+    for (uintptr_t v = 1; v < 99999; v++ ) {
+      TestLookup tl(v);
+      EXPECT_EQ(cht_get_copy(cht, this, tl), v) << "Getting an item after grow failed.";
+    }
+    delete cht;
+  }
+};
+
+TEST_VM(ConcurrentHashTable, concurrent_mt_grow) {
+  mt_test_doer<Driver_GT_Thread>();
+}
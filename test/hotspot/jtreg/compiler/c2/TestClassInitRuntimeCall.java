@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that C2 compiled code initializes classes that were not yet
+ *          initialized at compile time with UseClassInitRuntimeCall.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xcomp -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestClassInitRuntimeCall::test*
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseClassInitRuntimeCall
+ *                   compiler.c2.TestClassInitRuntimeCall
+ * @run main/othervm -Xcomp -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestClassInitRuntimeCall::test*
+ *                   -XX:+UnlockExperimentalVMOptions -XX:-UseClassInitRuntimeCall
+ *                   compiler.c2.TestClassInitRuntimeCall
+ */
+
+package compiler.c2;
+
+import java.util.concurrent.CountDownLatch;
+
+public class TestClassInitRuntimeCall {
+    static int staticInits;
+    static int newInits;
+    static boolean fail = true;
+    static final CountDownLatch slowStarted = new CountDownLatch(1);
+    static final CountDownLatch slowRelease = new CountDownLatch(1);
+
+    static class StaticHolder {
+        static int value;
+        static {
+            staticInits++;
+            value = 42;
+        }
+    }
+
+    static class NewHolder {
+        static {
+            newInits++;
+        }
+        int x = 7;
+    }
+
+    static class Failing {
+        static int value;
+        static {
+            if (fail) {
+                throw new RuntimeException("expected");
+            }
+        }
+    }
+
+    static class Recursive {
+        static int value;
+        static {
+            // Reads Recursive.value while Recursive is being initialized by
+            // this thread, which must see the default value.
+            value = testRecursive() + 1;
+        }
+    }
+
+    static class Slow {
+        static int value;
+        static {
+            slowStarted.countDown();
+            try {
+                slowRelease.await();
+            } catch (InterruptedException e) {
+                throw new RuntimeException(e);
+            }
+            value = 5;
+        }
+    }
+
+    static int testStatic() {
+        return StaticHolder.value;
+    }
+
+    static int testNew() {
+        return new NewHolder().x;
+    }
+
+    static int testFailing() {
+        return Failing.value;
+    }
+
+    static int testRecursive() {
+        return Recursive.value;
+    }
+
+    static int testSlow() {
+        return Slow.value;
+    }
+
+    static void check(boolean condition, String message) {
+        if (!condition) {
+            throw new RuntimeException(message);
+        }
+    }
+
+    // Load the classes without initializing them, so that C2 sees them as
+    // loaded but not initialized when it compiles the test methods.
+    static void load(String name) throws ClassNotFoundException {
+        Class.forName(TestClassInitRuntimeCall.class.getName() + "$" + name, false,
+                      TestClassInitRuntimeCall.class.getClassLoader());
+    }
+
+    public static void main(String[] args) throws Exception {
+        load("StaticHolder");
+        load("NewHolder");
+        load("Failing");
+        load("Recursive");
+        load("Slow");
+
+        for (int i = 0; i < 3; i++) {
+            check(testStatic() == 42, "wrong static field value");
+            check(testNew() == 7, "wrong instance field value");
+        }
+        check(staticInits == 1, "StaticHolder initialized " + staticInits + " times");
+        check(newInits == 1, "NewHolder initialized " + newInits + " times");
+
+        try {
+            testFailing();
+            throw new RuntimeException("no ExceptionInInitializerError");
+        } catch (ExceptionInInitializerError e) {
+            check(e.getCause().getMessage().equals("expected"), "unexpected cause " + e.getCause());
+        }
+        try {
+            testFailing();
+            throw new RuntimeException("no NoClassDefFoundError");
+        } catch (NoClassDefFoundError e) {
+            // Class is in the error state.
+        }
+
+        check(testRecursive() == 1, "recursive initialization returned " + Recursive.value);
+
+        // Initialize Slow in another thread and read from compiled code while
+        // that initialization is in progress; the read has to wait for it.
+        Thread initializer = new Thread(() -> {
+            try {
+                Class.forName(TestClassInitRuntimeCall.class.getName() + "$Slow", true,
+                              TestClassInitRuntimeCall.class.getClassLoader());
+            } catch (ClassNotFoundException e) {
+                throw new RuntimeException(e);
+            }
+        });
+        initializer.start();
+        slowStarted.await();
+        int[] result = new int[1];
+        Thread reader = new Thread(() -> result[0] = testSlow());
+        reader.start();
+        Thread.sleep(100);
+        slowRelease.countDown();
+        reader.join();
+        initializer.join();
+        check(result[0] == 5, "read " + result[0] + " before initialization completed");
+    }
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that C2 inlines the most frequent receivers of a megamorphic
+ *          call site with PolymorphicInlineLimit, and only where inlining is allowed.
+ * @requires vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver compiler.inlining.TestPolymorphicInlining
+ */
+
+package compiler.inlining;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPolymorphicInlining {
+    static abstract class Shape {
+        abstract int get();
+    }
+
+    static class A extends Shape { int get() { return 1; } }
+    static class B extends Shape { int get() { return 2; } }
+    static class C extends Shape { int get() { return 3; } }
+    static class D extends Shape { int get() { return 4; } }
+
+    static int test(Shape s) {
+        return s.get();
+    }
+
+    public static class Launcher {
+        public static void main(String[] args) {
+            Shape[] shapes = { new A(), new B(), new C(), new D() };
+            int sum = 0;
+            for (int i = 0; i < 100_000; i++) {
+                sum += test(shapes[i & 3]);
+            }
+            if (sum != 250_000) {
+                throw new RuntimeException("Unexpected sum " + sum);
+            }
+        }
+    }
+
+    static OutputAnalyzer run(String... extraFlags) throws Exception {
+        String[] flags = {
+            "-Xbatch",
+            "-XX:-TieredCompilation",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:TypeProfileWidth=4",
+            "-XX:PolymorphicInlineLimit=4",
+            "-XX:+PrintInlining",
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=compileonly," + TestPolymorphicInlining.class.getName() + "::test",
+        };
+        String[] args = new String[flags.length + extraFlags.length + 1];
+        System.arraycopy(flags, 0, args, 0, flags.length);
+        System.arraycopy(extraFlags, 0, args, flags.length, extraFlags.length);
+        args[args.length - 1] = Launcher.class.getName();
+        OutputAnalyzer output = ProcessTools.executeTestJvm(args);
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // All four receivers get a type check in the megamorphic call site.
+        OutputAnalyzer output = run();
+        for (String name : new String[] { "A", "B", "C", "D" }) {
+            // The profiled klass is printed with its internal name.
+            output.shouldContain("counts) = compiler/inlining/TestPolymorphicInlining$" + name);
+        }
+
+        // No type switch is built when the caller does not allow inlining.
+        output = run("-XX:-Inline", "-XX:-InlineAccessors");
+        output.shouldNotContain("TypeProfile (");
+    }
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check long range checks in long counted loops, which C2 turns into
+ *          int range checks of the inner loop of a loop nest, at the boundaries
+ *          of the long range and with positive and negative strides.
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   compiler.rangechecks.TestLongRangeChecks
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:-UseLoopPredicate
+ *                   compiler.rangechecks.TestLongRangeChecks
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:LoopStripMiningIter=0
+ *                   compiler.rangechecks.TestLongRangeChecks
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:LoopMaxUnroll=0
+ *                   compiler.rangechecks.TestLongRangeChecks
+ */
+
+package compiler.rangechecks;
+
+import java.util.Objects;
+
+public class TestLongRangeChecks {
+    // A stride this large makes the inner loop of the nest short, so
+    // that many iterations of the outer loop are executed.
+    static final long LARGE = 1L << 20;
+    static final long[] STRIDES = { 1, 7, LARGE, -1, -7, -LARGE };
+
+    static final int ITERATIONS = 2_000;
+    static final int ROUNDS = 20;
+
+    // Set by the test methods if the range check failed.
+    static boolean failed;
+
+    static long stride1(long start, long stop, long offset, long range) {
+        failed = false;
+        long i = start;
+        try {
+            for (; i < stop; i += 1) {
+                Objects.checkIndex(i + offset, range);
+            }
+        } catch (IndexOutOfBoundsException e) {
+            failed = true;
+        }
+        return i;
+    }
+
+    static long stride7(long start, long stop, long offset, long range) {
+        failed = false;
+        long i = start;
+        try {
+            for (; i < stop; i += 7) {
+                Objects.checkIndex(i + offset, range);
+            }
+        } catch (IndexOutOfBoundsException e) {
+            failed = true;
+        }
+        return i;
+    }
+
+    static long strideLarge(long start, long stop, long offset, long range) {
+        failed = false;
+        long i = start;
+        try {
+            for (; i < stop; i += LARGE) {
+                Objects.checkIndex(i + offset, range);
+            }
+        } catch (IndexOutOfBoundsException e) {
+            failed = true;
+        }
+        return i;
+    }
+
+    static long strideMinus1(long start, long stop, long offset, long range) {
+        failed = false;
+        long i = start;
+        try {
+            for (; i > stop; i -= 1) {
+                Objects.checkIndex(i + offset, range);
+            }
+        } catch (IndexOutOfBoundsException e) {
+            failed = true;
+        }
+        return i;
+    }
+
+    static long strideMinus7(long start, long stop, long offset, long range) {
+        failed = false;
+        long i = start;
+        try {
+            for (; i > stop; i -= 7) {
+                Objects.checkIndex(i + offset, range);
+            }
+        } catch (IndexOutOfBoundsException e) {
+            failed = true;
+        }
+        return i;
+    }
+
+    static long strideMinusLarge(long start, long stop, long offset, long range) {
+        failed = false;
+        long i = start;
+        try {
+            for (; i > stop; i -= LARGE) {
+                Objects.checkIndex(i + offset, range);
+            }
+        } catch (IndexOutOfBoundsException e) {
+            failed = true;
+        }
+        return i;
+    }
+
+    static long run(long stride, long start, long stop, long offset, long range) {
+        if (stride == 1) {
+            return stride1(start, stop, offset, range);
+        } else if (stride == 7) {
+            return stride7(start, stop, offset, range);
+        } else if (stride == LARGE) {
+            return strideLarge(start, stop, offset, range);
+        } else if (stride == -1) {
+            return strideMinus1(start, stop, offset, range);
+        } else if (stride == -7) {
+            return strideMinus7(start, stop, offset, range);
+        } else {
+            return strideMinusLarge(start, stop, offset, range);
+        }
+    }
+
+    // Straightforward version of the loops above, without exceptions.
+    static long reference(long stride, long start, long stop, long offset, long range, boolean[] refFailed) {
+        refFailed[0] = false;
+        long i = start;
+        for (; stride > 0 ? i < stop : i > stop; i += stride) {
+            long index = i + offset;
+            if (index < 0 || index >= range) {
+                refFailed[0] = true;
+                break;
+            }
+        }
+        return i;
+    }
+
+    static void check(long stride, long start, long offset, long range) {
+        // Stay clear of overflowing the iv itself.
+        long stop = start + stride * ITERATIONS;
+        boolean[] refFailed = new boolean[1];
+        long expected = reference(stride, start, stop, offset, range, refFailed);
+        long actual = run(stride, start, stop, offset, range);
+        if (actual != expected || failed != refFailed[0]) {
+            throw new RuntimeException("stride " + stride + " start " + start + " offset " + offset +
+                                       " range " + range + ": stopped at " + actual + (failed ? " (failed)" : "") +
+                                       ", expected " + expected + (refFailed[0] ? " (failed)" : ""));
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int round = 0; round < ROUNDS; round++) {
+            for (long stride : STRIDES) {
+                long span = Math.abs(stride) * ITERATIONS;
+                // Start points so that the loop runs at the very beginning
+                // and end of the long range, and around zero.
+                long[] starts = {
+                    0, -span / 2, span,
+                    stride > 0 ? Long.MIN_VALUE : Long.MIN_VALUE + span + 1,
+                    stride > 0 ? Long.MAX_VALUE - span - 1 : Long.MAX_VALUE,
+                };
+                for (long start : starts) {
+                    long last = start + stride * (ITERATIONS - 1);
+                    long low = Math.min(start, last);
+                    long high = Math.max(start, last);
+                    long[] offsets = {
+                        0, -low, -high, -low - 1, -high + 1, -start - span / 2,
+                        // i + offset overflows for some or all iterations.
+                        Long.MIN_VALUE, Long.MAX_VALUE, Long.MIN_VALUE - low, Long.MAX_VALUE - high + 1,
+                    };
+                    long[] ranges = {
+                        0, 1, span / 2, span, span + 1, Integer.MAX_VALUE, (long)Integer.MAX_VALUE + 1,
+                        Long.MAX_VALUE - 1, Long.MAX_VALUE,
+                    };
+                    for (long offset : offsets) {
+                        for (long range : ranges) {
+                            check(stride, start, offset, range);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.vectorization;
+
+import compiler.lib.ir_framework.*;
+import jdk.internal.misc.Unsafe;
+
+/*
+ * @test
+ * @summary Check that SuperWord vectorizes Unsafe accesses whose offset is a
+ *          long invariant plus a scaled int iv, and still rejects offsets
+ *          that are not of that form.
+ * @requires vm.compiler2.enabled
+ * @requires os.arch=="amd64" | os.arch=="x86_64" | os.arch=="aarch64"
+ * @modules java.base/jdk.internal.misc
+ * @library /test/lib /
+ * @run driver compiler.vectorization.TestLongOffsetUnsafeVectorization
+ */
+public class TestLongOffsetUnsafeVectorization {
+    private static final Unsafe UNSAFE = Unsafe.getUnsafe();
+    private static final long INT_BASE = UNSAFE.arrayBaseOffset(int[].class);
+    private static final int SIZE = 1024;
+
+    // Not final, so that C2 sees a loop invariant and not a constant.
+    private static long offset = 4 * 8;
+    private static long scale = 4;
+
+    private static int[] src = new int[SIZE];
+    private static int[] dst = new int[SIZE];
+    private static long[] offsets = new long[SIZE];
+
+    public static void main(String[] args) {
+        TestFramework.runWithFlags("--add-modules", "java.base",
+                                   "--add-exports", "java.base/jdk.internal.misc=ALL-UNNAMED");
+    }
+
+    private static void init() {
+        for (int i = 0; i < SIZE; i++) {
+            src[i] = i;
+            dst[i] = -1;
+            offsets[i] = INT_BASE + 4L * ((i * 7) % SIZE);
+        }
+    }
+
+    private static void checkShifted(int count, int shift) {
+        for (int i = 0; i < count; i++) {
+            if (dst[i + shift] != src[i + shift] + 1) {
+                throw new RuntimeException("dst[" + (i + shift) + "] = " + dst[i + shift]);
+            }
+        }
+    }
+
+    // AddL(invariant, scaled iv)
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR, "> 0", IRNode.STORE_VECTOR, "> 0"})
+    public static void addInvariantScaledIV() {
+        long off = offset;
+        for (int i = 0; i < SIZE - 8; i++) {
+            long adr = INT_BASE + off + ((long)i << 2);
+            UNSAFE.putInt(dst, adr, UNSAFE.getInt(src, adr) + 1);
+        }
+    }
+
+    @Run(test = "addInvariantScaledIV")
+    public static void runAddInvariantScaledIV() {
+        init();
+        addInvariantScaledIV();
+        checkShifted(SIZE - 8, 8);
+    }
+
+    // AddL(scaled iv, invariant)
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR, "> 0", IRNode.STORE_VECTOR, "> 0"})
+    public static void addScaledIVInvariant() {
+        long off = offset;
+        for (int i = 0; i < SIZE - 8; i++) {
+            long adr = ((long)i << 2) + off + INT_BASE;
+            UNSAFE.putInt(dst, adr, UNSAFE.getInt(src, adr) + 1);
+        }
+    }
+
+    @Run(test = "addScaledIVInvariant")
+    public static void runAddScaledIVInvariant() {
+        init();
+        addScaledIVInvariant();
+        checkShifted(SIZE - 8, 8);
+    }
+
+    // SubL(scaled iv, invariant)
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR, "> 0", IRNode.STORE_VECTOR, "> 0"})
+    public static void subScaledIVInvariant() {
+        long off = offset;
+        for (int i = 8; i < SIZE; i++) {
+            long adr = INT_BASE + ((long)i << 2) - off;
+            UNSAFE.putInt(dst, adr, UNSAFE.getInt(src, adr) + 1);
+        }
+    }
+
+    @Run(test = "subScaledIVInvariant")
+    public static void runSubScaledIVInvariant() {
+        init();
+        subScaledIVInvariant();
+        checkShifted(SIZE - 8, 0);
+    }
+
+    // The offset is loaded in the loop, so it is not of the form
+    // invariant + scaled iv and the accesses must not be vectorized.
+    @Test
+    @IR(failOn = IRNode.STORE_VECTOR)
+    public static void loopVariantOffset() {
+        for (int i = 0; i < SIZE; i++) {
+            long adr = offsets[i];
+            UNSAFE.putInt(dst, adr, UNSAFE.getInt(src, adr) + 1);
+        }
+    }
+
+    @Run(test = "loopVariantOffset")
+    public static void runLoopVariantOffset() {
+        init();
+        loopVariantOffset();
+        checkShifted(SIZE, 0);
+    }
+
+    // The iv is scaled by an invariant, not a constant, so SWPointer can not
+    // compute the stride of the accesses.
+    @Test
+    @IR(failOn = IRNode.STORE_VECTOR)
+    public static void invariantScale() {
+        long s = scale;
+        for (int i = 0; i < SIZE; i++) {
+            long adr = INT_BASE + (long)i * s;
+            UNSAFE.putInt(dst, adr, UNSAFE.getInt(src, adr) + 1);
+        }
+    }
+
+    @Run(test = "invariantScale")
+    public static void runInvariantScale() {
+        init();
+        invariantScale();
+        checkShifted(SIZE, 0);
+    }
+
+    // Off-heap accesses compute the address entirely in long arithmetic and
+    // cast it with CastX2P inside the loop. SWPointer does not parse those
+    // yet, so only check the result.
+    @Test
+    public static void offHeap(long address) {
+        long off = offset;
+        for (int i = 0; i < SIZE - 8; i++) {
+            long adr = address + off + ((long)i << 2);
+            UNSAFE.putInt(adr, UNSAFE.getInt(adr) + 1);
+        }
+    }
+
+    @Run(test = "offHeap")
+    public static void runOffHeap() {
+        long address = UNSAFE.allocateMemory(4L * SIZE);
+        try {
+            for (int i = 0; i < SIZE; i++) {
+                UNSAFE.putInt(address + 4L * i, i);
+            }
+            offHeap(address);
+            for (int i = 8; i < SIZE; i++) {
+                int v = UNSAFE.getInt(address + 4L * i);
+                if (v != i + 1) {
+                    throw new RuntimeException("off-heap element " + i + " = " + v);
+                }
+            }
+        } finally {
+            UNSAFE.freeMemory(address);
+        }
+    }
+}
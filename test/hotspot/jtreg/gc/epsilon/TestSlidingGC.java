@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestSlidingGC
+ * @requires vm.gc.Epsilon
+ * @summary Epsilon sliding mark-compact keeps live objects, their identity
+ *          hash codes and monitors intact while moving them
+ *
+ * @run main/othervm -Xmx64m -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC
+ *                   TestSlidingGC
+ * @run main/othervm -Xmx64m -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC
+ *                   -XX:-UseTLAB TestSlidingGC
+ * @run main/othervm -Xmx64m -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC
+ *                   -Xint TestSlidingGC
+ * @run main/othervm -Xmx64m -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC
+ *                   -Xcomp TestSlidingGC
+ */
+
+public class TestSlidingGC {
+    static class Node {
+        final int id;
+        final int[] payload;
+        Node next;
+
+        Node(int id) {
+            this.id = id;
+            this.payload = new int[] { id };
+        }
+    }
+
+    // Allocate well past -Xmx, with a live set of a few hundred kilobytes.
+    static final int  LIVE_NODES      = 10_000;
+    static final long TOTAL_ALLOC     = 1024L * 1024 * 1024;
+    static final long VERIFY_INTERVAL = 16L * 1024 * 1024;
+    static final long SYSTEM_GC_EVERY = 8;
+
+    static volatile Object sink;
+
+    static Node head;
+    static Node[] nodes;
+    static int[] hashes;
+
+    public static void main(String... args) throws Exception {
+        // Interleave the live objects with garbage so that they actually move.
+        nodes = new Node[LIVE_NODES];
+        hashes = new int[LIVE_NODES];
+        Node prev = null;
+        for (int i = 0; i < LIVE_NODES; i++) {
+            Node n = new Node(i);
+            sink = new byte[128];
+            nodes[i] = n;
+            // Only install the identity hash code in some of the mark words.
+            hashes[i] = (i % 3 == 0) ? System.identityHashCode(n) : 0;
+            if (prev == null) {
+                head = n;
+            } else {
+                prev.next = n;
+            }
+            prev = n;
+        }
+
+        // A monitor that is held across collections, with another thread
+        // blocked on it, and a stack lock held across System.gc().
+        Object lock = new Object();
+        int lockHash = System.identityHashCode(lock);
+        Thread contender;
+        synchronized (lock) {
+            contender = new Thread(() -> {
+                synchronized (lock) {
+                    sink = lock;
+                }
+            });
+            contender.start();
+            churn();
+            if (!Thread.holdsLock(lock)) {
+                throw new RuntimeException("Lost the monitor while objects moved");
+            }
+        }
+        contender.join();
+
+        Object stackLocked = new Object();
+        synchronized (stackLocked) {
+            sink = new byte[1024 * 1024];
+            System.gc();
+            if (!Thread.holdsLock(stackLocked)) {
+                throw new RuntimeException("Lost the stack lock while objects moved");
+            }
+        }
+
+        if (System.identityHashCode(lock) != lockHash) {
+            throw new RuntimeException("Identity hash code of monitor changed");
+        }
+        verify();
+    }
+
+    static void churn() {
+        long allocated = 0;
+        long verifications = 0;
+        while (allocated < TOTAL_ALLOC) {
+            for (long i = 0; i < VERIFY_INTERVAL; i += 1024) {
+                sink = new byte[1000];
+            }
+            allocated += VERIFY_INTERVAL;
+            if (++verifications % SYSTEM_GC_EVERY == 0) {
+                System.gc();
+            }
+            verify();
+        }
+    }
+
+    static void verify() {
+        Node n = head;
+        for (int i = 0; i < LIVE_NODES; i++) {
+            if (n == null) {
+                throw new RuntimeException("List ends early at " + i);
+            }
+            if (n != nodes[i]) {
+                throw new RuntimeException("List and array disagree at " + i);
+            }
+            if (n.id != i || n.payload.length != 1 || n.payload[0] != i) {
+                throw new RuntimeException("Corrupted node " + i + ": id " + n.id);
+            }
+            if (hashes[i] != 0 && System.identityHashCode(n) != hashes[i]) {
+                throw new RuntimeException("Identity hash code of node " + i + " changed");
+            }
+            n = n.next;
+        }
+        if (n != null) {
+            throw new RuntimeException("List is too long");
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestSlidingGCJNICritical
+ * @requires vm.gc.Epsilon
+ * @summary Epsilon sliding mark-compact stalls allocations instead of failing
+ *          them while threads are in JNI critical regions
+ *
+ * @run main/othervm/native -Xmx32m -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC
+ *                          TestSlidingGCJNICritical
+ * @run main/othervm/native -Xmx32m -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC -XX:+EpsilonSlidingGC
+ *                          -Xcheck:jni TestSlidingGCJNICritical
+ */
+
+import java.util.Arrays;
+
+public class TestSlidingGCJNICritical {
+    static {
+        System.loadLibrary("TestSlidingGCJNICritical");
+    }
+
+    private static final int NUM_THREADS = 4;
+    private static final int NUM_RUNS    = 20_000;
+    private static final int ARRAY_SIZE  = 10_000;
+
+    static volatile Object sink;
+
+    private static native void copyAtoB(int[] a, int[] b);
+
+    public static void main(String[] args) throws Exception {
+        // Threads doing critical copies while others allocate past -Xmx, so
+        // that collections are requested while critical regions are active.
+        Thread[] threads = new Thread[NUM_THREADS * 2];
+        Throwable[] failure = new Throwable[1];
+        for (int t = 0; t < NUM_THREADS; t++) {
+            final int seed = t;
+            threads[2 * t] = new Thread(() -> copyLoop(seed));
+            threads[2 * t + 1] = new Thread(TestSlidingGCJNICritical::allocLoop);
+        }
+        for (Thread t : threads) {
+            t.setUncaughtExceptionHandler((th, e) -> {
+                synchronized (failure) {
+                    failure[0] = e;
+                }
+            });
+            t.start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        if (failure[0] != null) {
+            throw new RuntimeException("Test thread failed", failure[0]);
+        }
+    }
+
+    private static void copyLoop(int seed) {
+        int[] a = new int[ARRAY_SIZE];
+        int[] b = new int[ARRAY_SIZE];
+        for (int i = 0; i < NUM_RUNS; i++) {
+            Arrays.fill(a, seed + i);
+            copyAtoB(a, b);
+            if (!Arrays.equals(a, b)) {
+                throw new RuntimeException("arrays not equal");
+            }
+            // Garbage between the live arrays makes them move.
+            sink = new int[ARRAY_SIZE];
+        }
+    }
+
+    private static void allocLoop() {
+        for (int i = 0; i < NUM_RUNS; i++) {
+            sink = new int[ARRAY_SIZE];
+        }
+    }
+}
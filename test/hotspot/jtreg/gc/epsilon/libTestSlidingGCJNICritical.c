@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -19,19 +19,17 @@
  * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
  * or visit www.oracle.com if you need additional information or have any
  * questions.
- *
  */
 
-#ifndef SHARE_GC_G1_SPARSEPRT_INLINE_HPP
-#define SHARE_GC_G1_SPARSEPRT_INLINE_HPP
-
-#include "gc/g1/sparsePRT.hpp"
-
-#include "gc/g1/g1CollectedHeap.hpp"
+#include <jni.h>
+#include <string.h>
 
-inline bool SparsePRT::contains_card(RegionIdx_t region_id, CardIdx_t card_index) const {
-  return _table->contains_card(region_id, card_index);
+JNIEXPORT void JNICALL
+Java_TestSlidingGCJNICritical_copyAtoB(JNIEnv *env, jclass unused, jintArray a, jintArray b) {
+  jint len = (*env)->GetArrayLength(env, a);
+  jint* aa = (*env)->GetPrimitiveArrayCritical(env, a, 0);
+  jint* bb = (*env)->GetPrimitiveArrayCritical(env, b, 0);
+  memcpy(bb, aa, len * sizeof(jint));
+  (*env)->ReleasePrimitiveArrayCritical(env, b, bb, 0);
+  (*env)->ReleasePrimitiveArrayCritical(env, a, aa, 0);
 }
-
-
-#endif // SHARE_GC_G1_SPARSEPRT_INLINE_HPP
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+package gc.g1;
+
+/*
+ * @test TestEagerReclaimHumongousObjArrays
+ * @summary Test to make sure that humongous object arrays that die young are
+ * eagerly reclaimed. Every iteration allocates a humongous object array referencing
+ * some young objects and drops it again. Since there is no concurrent cycle, the
+ * arrays should be reclaimed at young gcs.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run driver gc.g1.TestEagerReclaimHumongousObjArrays
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import static jdk.test.lib.Asserts.*;
+import sun.hotspot.WhiteBox;
+
+public class TestEagerReclaimHumongousObjArrays {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseG1GC",
+            "-XX:G1HeapRegionSize=1M",
+            "-Xms128M",
+            "-Xmx128M",
+            "-Xlog:gc+phases=trace",
+            GCTest.class.getName());
+
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        System.out.println(output.getStdout());
+
+        Pattern p = Pattern.compile("Humongous ObjArrays Reclaimed: .*Sum: (\\d+),");
+        Matcher m = p.matcher(output.getStdout());
+        int reclaimed = 0;
+        while (m.find()) {
+            reclaimed += Integer.parseInt(m.group(1));
+        }
+        System.out.println("Reclaimed " + reclaimed + " humongous object arrays");
+
+        assertGT(reclaimed, 0, "No humongous object arrays were eagerly reclaimed");
+    }
+
+    static class GCTest {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        public static Object[] holder;
+
+        public static void main(String [] args) {
+            for (int i = 0; i < 10; i++) {
+                // An object array spanning multiple regions referencing young objects.
+                holder = new Object[1024 * 1024];
+                for (int j = 0; j < holder.length; j += 1024) {
+                    holder[j] = new Object();
+                }
+                WB.youngGC();
+                System.out.println(holder.length);
+                holder = null;
+                WB.youngGC();
+            }
+        }
+    }
+}
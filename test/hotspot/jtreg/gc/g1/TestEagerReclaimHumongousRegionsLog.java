@@ -78,25 +78,28 @@ public class TestEagerReclaimHumongousRegionsLog {
         //   Humongous Total: Min: 1, Avg:  1.0, Max: 1, Diff: 0, Sum: c, Workers: 1
         //   Humongous Candidate: Min: 1, Avg:  1.0, Max: 1, Diff: 0, Sum: d, Workers: 1
         //   Humongous Reclaimed: Min: 1, Avg:  1.0, Max: 1, Diff: 0, Sum: e, Workers: 1
-        //   Humongous Regions: f->g
+        //   Humongous ObjArrays Reclaimed: Min: 1, Avg:  1.0, Max: 1, Diff: 0, Sum: f, Workers: 1
+        //   Humongous Regions: g->h
 
         String[] lines = Arrays.stream(output.getStdout().split("\\R"))
                          .filter(s -> (s.contains("Humongous") || s.contains("Region Register"))).map(s -> s.substring(s.indexOf(LogSeparator) + LogSeparator.length()))
                          .toArray(String[]::new);
 
-        Asserts.assertTrue(lines.length % 6 == 0, "There seems to be an unexpected amount of log messages (total: " + lines.length + ") per GC");
+        Asserts.assertTrue(lines.length % 7 == 0, "There seems to be an unexpected amount of log messages (total: " + lines.length + ") per GC");
 
-        for (int i = 0; i < lines.length; i += 6) {
+        for (int i = 0; i < lines.length; i += 7) {
             int total = Integer.parseInt(getSumValue(lines[i + 2]));
             int candidate = Integer.parseInt(getSumValue(lines[i + 3]));
             int reclaimed = Integer.parseInt(getSumValue(lines[i + 4]));
+            int reclaimedObjArrays = Integer.parseInt(getSumValue(lines[i + 5]));
 
-            int before = Integer.parseInt(lines[i + 5].substring(0, 1));
-            int after = Integer.parseInt(lines[i + 5].substring(3, 4));
-            System.out.println("total " + total + " candidate " + candidate + " reclaimed " + reclaimed + " before " + before + " after " + after);
+            int before = Integer.parseInt(lines[i + 6].substring(0, 1));
+            int after = Integer.parseInt(lines[i + 6].substring(3, 4));
+            System.out.println("total " + total + " candidate " + candidate + " reclaimed " + reclaimed + " reclaimed objarrays " + reclaimedObjArrays + " before " + before + " after " + after);
 
             Asserts.assertEQ(total, candidate, "Not all humonguous objects are candidates");
             Asserts.assertLTE(reclaimed, candidate, "The number of reclaimed objects must be less or equal than the number of candidates");
+            Asserts.assertEQ(reclaimedObjArrays, 0, "There are no humongous object arrays to reclaim");
 
             if (reclaimed > 0) {
                Asserts.assertLT(after, before, "Number of regions after must be smaller than before.");
@@ -58,6 +58,7 @@ public class TestG1TraceEagerReclaimHumongousObjects {
     output.shouldContain("Humongous Total");
     output.shouldContain("Humongous Candidate");
     output.shouldContain("Humongous Reclaimed");
+    output.shouldContain("Humongous ObjArrays Reclaimed");
 
     // As G1TraceReclaimDeadHumongousObjectsAtYoungGC is set and GCWithHumongousObjectTest has humongous objects,
     // these logs should be displayed.
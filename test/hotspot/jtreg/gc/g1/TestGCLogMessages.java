@@ -101,9 +101,9 @@ public class TestGCLogMessages {
         new LogMessageWithLevel("Prepare Merge Heap Roots", Level.DEBUG),
         new LogMessageWithLevel("Eager Reclaim", Level.DEBUG),
         new LogMessageWithLevel("Remembered Sets", Level.DEBUG),
-        new LogMessageWithLevel("Merged Sparse", Level.DEBUG),
-        new LogMessageWithLevel("Merged Fine", Level.DEBUG),
-        new LogMessageWithLevel("Merged Coarse", Level.DEBUG),
+        new LogMessageWithLevel("Merged Array", Level.DEBUG),
+        new LogMessageWithLevel("Merged BitMap", Level.DEBUG),
+        new LogMessageWithLevel("Merged Full", Level.DEBUG),
         new LogMessageWithLevel("Hot Card Cache", Level.DEBUG),
         new LogMessageWithLevel("Log Buffers", Level.DEBUG),
         new LogMessageWithLevel("Dirty Cards", Level.DEBUG),
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestPinnedObjects
+ * @summary Check that G1 keeps arrays held in JNI critical sections in place
+ *          across young, mixed and full collections without treating the
+ *          retained regions as an evacuation failure.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build sun.hotspot.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller sun.hotspot.WhiteBox
+ * @run main/othervm/native gc.g1.TestPinnedObjects
+ */
+
+import java.util.ArrayList;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import sun.hotspot.WhiteBox;
+
+public class TestPinnedObjects {
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createJavaProcessBuilder(
+                "-Djava.library.path=" + System.getProperty("java.library.path"),
+                "-Xbootclasspath/a:.",
+                "-XX:+UseG1GC",
+                "-XX:+UnlockDiagnosticVMOptions",
+                "-XX:+UnlockExperimentalVMOptions",
+                "-XX:+WhiteBoxAPI",
+                "-XX:+VerifyBeforeGC",
+                "-XX:+VerifyAfterGC",
+                "-XX:G1HeapRegionSize=1m",
+                "-XX:G1MixedGCLiveThresholdPercent=100",
+                "-XX:G1HeapWastePercent=0",
+                "-Xms32m",
+                "-Xmx32m",
+                "-Xlog:gc",
+                PinningTest.class.getName());
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        System.out.println(output.getStdout());
+
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Pause Young (Normal)");
+        output.shouldContain("Pause Young (Mixed)");
+        output.shouldContain("Pause Full");
+        // Pinned regions are retained, which is not an allocation failure.
+        output.shouldNotContain("To-space exhausted");
+    }
+
+    public static class PinningTest {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+        private static final int ARRAY_LENGTH = 1024;
+
+        static {
+            System.loadLibrary("TestPinnedObjects");
+        }
+
+        // Enters a critical section on the array and keeps it open.
+        private static native boolean pin(int[] array);
+        // Returns whether the array still lives at the address seen by pin().
+        private static native boolean isAtPinnedAddress(int[] array);
+        // Writes value into every element through the pinned pointer.
+        private static native void fillPinned(int value);
+        // Leaves the critical section entered by pin().
+        private static native void unpin(int[] array);
+
+        private static ArrayList<Object> garbage = new ArrayList<>();
+
+        public static void main(String[] args) throws Exception {
+            // Young collection: the pinned array is still in eden.
+            int[] young = new int[ARRAY_LENGTH];
+            holdAcross(young, 1, () -> WB.youngGC());
+
+            // Mixed collections: the pinned array is in an old region that the
+            // concurrent cycle found to be mostly garbage.
+            int[] old = new int[ARRAY_LENGTH];
+            allocateOldGarbage();
+            holdAcross(old, 2, () -> {
+                WB.g1StartConcMarkCycle();
+                while (WB.g1InConcurrentMark()) {
+                    sleep();
+                }
+                // The first young collection after Cleanup prepares the
+                // mixed phase, the following ones are mixed.
+                for (int i = 0; i < 4; i++) {
+                    WB.youngGC();
+                }
+            });
+
+            // Full collection: compaction must leave the pinned region alone.
+            int[] full = new int[ARRAY_LENGTH];
+            holdAcross(full, 3, () -> WB.fullGC());
+        }
+
+        private static void holdAcross(int[] array, int value, Runnable gcs) {
+            if (!pin(array)) {
+                throw new RuntimeException("Could not enter critical section");
+            }
+            try {
+                gcs.run();
+                if (!isAtPinnedAddress(array)) {
+                    throw new RuntimeException("Pinned array moved");
+                }
+                fillPinned(value);
+            } finally {
+                unpin(array);
+            }
+            for (int i = 0; i < array.length; i++) {
+                if (array[i] != value) {
+                    throw new RuntimeException("array[" + i + "] is " + array[i] + ", expected " + value);
+                }
+            }
+        }
+
+        private static void allocateOldGarbage() {
+            for (int i = 0; i < 64 * 1024; i++) {
+                garbage.add(new byte[64]);
+            }
+            // Promote everything, then drop most of it so that the old regions
+            // become candidates for mixed collections.
+            WB.fullGC();
+            for (int i = 0; i < garbage.size(); i++) {
+                if (i % 8 != 0) {
+                    garbage.set(i, null);
+                }
+            }
+        }
+
+        private static void sleep() {
+            try {
+                Thread.sleep(100);
+            } catch (InterruptedException e) {
+                throw new RuntimeException(e);
+            }
+        }
+    }
+}
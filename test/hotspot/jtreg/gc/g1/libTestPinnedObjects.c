@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * Native support for TestPinnedObjects test.
+ */
+
+#include "jni.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static jint* pinned_elements = NULL;
+static jsize pinned_length = 0;
+
+JNIEXPORT jboolean JNICALL
+Java_gc_g1_TestPinnedObjects_00024PinningTest_pin(JNIEnv* env, jclass clazz, jintArray array) {
+    pinned_length = (*env)->GetArrayLength(env, array);
+    pinned_elements = (jint*)(*env)->GetPrimitiveArrayCritical(env, array, NULL);
+    return pinned_elements != NULL ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_gc_g1_TestPinnedObjects_00024PinningTest_isAtPinnedAddress(JNIEnv* env, jclass clazz, jintArray array) {
+    jint* elements = (jint*)(*env)->GetPrimitiveArrayCritical(env, array, NULL);
+    jboolean result = elements == pinned_elements ? JNI_TRUE : JNI_FALSE;
+    if (elements != NULL) {
+        (*env)->ReleasePrimitiveArrayCritical(env, array, elements, 0);
+    }
+    return result;
+}
+
+JNIEXPORT void JNICALL
+Java_gc_g1_TestPinnedObjects_00024PinningTest_fillPinned(JNIEnv* env, jclass clazz, jint value) {
+    jsize i;
+    for (i = 0; i < pinned_length; i++) {
+        pinned_elements[i] = value;
+    }
+}
+
+JNIEXPORT void JNICALL
+Java_gc_g1_TestPinnedObjects_00024PinningTest_unpin(JNIEnv* env, jclass clazz, jintArray array) {
+    (*env)->ReleasePrimitiveArrayCritical(env, array, pinned_elements, 0);
+    pinned_elements = NULL;
+    pinned_length = 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
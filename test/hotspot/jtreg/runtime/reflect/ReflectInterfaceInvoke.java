@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that reflective interface calls through the VM select the right method
+ * @run main/othervm -Dsun.reflect.inflationThreshold=2147483647 ReflectInterfaceInvoke
+ */
+
+import java.lang.reflect.InvocationTargetException;
+import java.lang.reflect.Method;
+
+public class ReflectInterfaceInvoke {
+    interface I {
+        int m();
+        default int d() { return 2; }
+    }
+
+    interface J extends I {
+        default int d() { return 4; }
+    }
+
+    static class A implements I {
+        public int m() { return 1; }
+    }
+
+    static class B extends A {
+        public int m() { return 10; }
+        public int d() { return 3; }
+    }
+
+    static class C implements J {
+        public int m() { return 5; }
+        public int hashCode() { return 6; }
+    }
+
+    static class T implements I {
+        public int m() { throw new IllegalStateException(); }
+    }
+
+    static void check(Method method, Object receiver, int expected) throws Exception {
+        int result = (Integer) method.invoke(receiver);
+        if (result != expected) {
+            throw new RuntimeException(method + " on " + receiver.getClass() +
+                                       " returned " + result + ", expected " + expected);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Method m = I.class.getMethod("m");
+        Method d = I.class.getMethod("d");
+        Method hashCode = Object.class.getMethod("hashCode");
+
+        // Run often enough to also cover compiled callers.
+        for (int i = 0; i < 20_000; i++) {
+            check(m, new A(), 1);
+            check(m, new B(), 10);
+            check(m, new C(), 5);
+            check(d, new A(), 2);
+            check(d, new B(), 3);
+            check(d, new C(), 4);
+            check(hashCode, new C(), 6);
+        }
+
+        try {
+            m.invoke(new T());
+            throw new RuntimeException("InvocationTargetException expected");
+        } catch (InvocationTargetException e) {
+            if (!(e.getCause() instanceof IllegalStateException)) {
+                throw new RuntimeException("Unexpected cause", e.getCause());
+            }
+        }
+
+        try {
+            m.invoke("not an I");
+            throw new RuntimeException("IllegalArgumentException expected");
+        } catch (IllegalArgumentException e) {
+            // expected
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Measures how quickly a freshly started VM reaches peak performance.
+ *
+ * Every fork runs the same batch of work repeatedly without any warmup
+ * iterations, and every iteration is reported separately. Run with
+ * {@code -rf json} (or look at the per-iteration output) to get the warmup
+ * curve; the ratio of an iteration's time to the time of the last
+ * iterations is the fraction of peak performance reached at that point.
+ * The different benchmarks compare the compilation policies.
+ */
+@BenchmarkMode(Mode.SingleShotTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 0)
+@Measurement(iterations = 50)
+@State(Scope.Thread)
+public class WarmupCurve {
+
+    private static final int BATCH = 2_000;
+
+    private final List<String> words = new ArrayList<>();
+
+    public WarmupCurve() {
+        for (int i = 0; i < 1_000; i++) {
+            words.add(Integer.toString(i * 7919, 36));
+        }
+    }
+
+    // A mix of virtual calls, allocation, hashing and sorting that needs
+    // a number of methods compiled before it runs at full speed.
+    private int work() {
+        int result = 0;
+        for (int i = 0; i < BATCH; i++) {
+            Map<String, Integer> counts = new HashMap<>();
+            for (int j = i % 10; j < words.size(); j += 10) {
+                String w = words.get(j);
+                counts.merge(w.substring(0, Math.min(2, w.length())), 1, Integer::sum);
+            }
+            List<String> keys = new ArrayList<>(counts.keySet());
+            Collections.sort(keys);
+            result += keys.get(0).hashCode() + counts.size();
+        }
+        return result;
+    }
+
+    @Benchmark
+    @Fork(5)
+    public int tiered() {
+        return work();
+    }
+
+    @Benchmark
+    @Fork(value = 5, jvmArgsAppend = "-XX:TieredStopAtLevel=1")
+    public int c1Only() {
+        return work();
+    }
+
+    @Benchmark
+    @Fork(value = 5, jvmArgsAppend = "-XX:-TieredCompilation")
+    public int c2Only() {
+        return work();
+    }
+}
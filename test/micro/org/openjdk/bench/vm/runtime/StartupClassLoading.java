@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2021, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.runtime;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.util.AbstractList;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.concurrent.TimeUnit;
+import java.util.function.Supplier;
+
+/**
+ * Measures the cost of loading, linking and initializing a set of classes,
+ * with and without the default CDS archive.
+ *
+ * The JMH harness itself loads many JDK classes before the benchmark runs,
+ * so loading JDK classes by name would mostly find them loaded already.
+ * Instead, the benchmark defines fresh copies of the nested template classes
+ * below in a new class loader for every measurement. Nobody else can have
+ * loaded these copies, and their supertypes and the classes they refer to
+ * still exercise the JDK classes from the archive or the jimage.
+ */
+@BenchmarkMode(Mode.SingleShotTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@Warmup(iterations = 0)
+@Measurement(iterations = 1)
+@State(Scope.Thread)
+public class StartupClassLoading {
+
+    private static final String[] TEMPLATES = {
+        StartupClassLoading.class.getName() + "$Template0",
+        StartupClassLoading.class.getName() + "$Template1",
+        StartupClassLoading.class.getName() + "$Template2",
+        StartupClassLoading.class.getName() + "$Template3",
+        StartupClassLoading.class.getName() + "$Template4",
+        StartupClassLoading.class.getName() + "$Template5",
+        StartupClassLoading.class.getName() + "$Template6",
+        StartupClassLoading.class.getName() + "$Template7",
+    };
+
+    private final Map<String, byte[]> classBytes = new HashMap<>();
+
+    // Defines the template classes from their class file bytes instead of
+    // delegating them to the application class loader.
+    private static class FreshLoader extends ClassLoader {
+        private final Map<String, byte[]> classBytes;
+
+        FreshLoader(Map<String, byte[]> classBytes) {
+            super(StartupClassLoading.class.getClassLoader());
+            this.classBytes = classBytes;
+        }
+
+        @Override
+        protected Class<?> loadClass(String name, boolean resolve) throws ClassNotFoundException {
+            synchronized (getClassLoadingLock(name)) {
+                Class<?> c = findLoadedClass(name);
+                if (c == null) {
+                    byte[] b = classBytes.get(name);
+                    if (b == null) {
+                        return super.loadClass(name, resolve);
+                    }
+                    c = defineClass(name, b, 0, b.length);
+                }
+                if (resolve) {
+                    resolveClass(c);
+                }
+                return c;
+            }
+        }
+    }
+
+    @Setup
+    public void setup() throws IOException {
+        // Reading the class files is not part of the measurement.
+        for (String name : TEMPLATES) {
+            String resource = "/" + name.replace('.', '/') + ".class";
+            try (InputStream in = StartupClassLoading.class.getResourceAsStream(resource)) {
+                classBytes.put(name, in.readAllBytes());
+            }
+        }
+    }
+
+    private void loadAll(Blackhole bh) throws ClassNotFoundException {
+        ClassLoader loader = new FreshLoader(classBytes);
+        for (String name : TEMPLATES) {
+            bh.consume(Class.forName(name, true, loader));
+        }
+    }
+
+    @Benchmark
+    @Fork(20)
+    public void defaultArchive(Blackhole bh) throws ClassNotFoundException {
+        loadAll(bh);
+    }
+
+    @Benchmark
+    @Fork(value = 20, jvmArgsAppend = "-Xshare:off")
+    public void noArchive(Blackhole bh) throws ClassNotFoundException {
+        loadAll(bh);
+    }
+
+    // Templates with a mix of supertypes, fields, methods and static
+    // initializers, so that loading them also resolves and verifies
+    // references to JDK classes.
+
+    static class Template0 implements Comparable<Template0> {
+        static final Map<String, Integer> TABLE = new HashMap<>();
+        static {
+            for (int i = 0; i < 16; i++) {
+                TABLE.put("key" + i, i);
+            }
+        }
+        int value;
+        public int compareTo(Template0 o) { return Integer.compare(value, o.value); }
+    }
+
+    static class Template1 extends AbstractList<String> {
+        static final Template1 INSTANCE = new Template1();
+        public String get(int index) { return Integer.toString(index); }
+        public int size() { return 8; }
+    }
+
+    static class Template2 implements Supplier<StringBuilder> {
+        static final String GREETING = new Template2().get().append("!").toString();
+        public StringBuilder get() { return new StringBuilder("hello"); }
+    }
+
+    static class Template3 extends Template0 implements Runnable {
+        static long counter = System.nanoTime();
+        public void run() { counter++; }
+    }
+
+    enum Template4 {
+        RED, GREEN, BLUE;
+        static final Template4[] ALL = values();
+    }
+
+    static class Template5 extends Exception {
+        static final Template5 SHARED = new Template5("shared");
+        Template5(String message) { super(message, null, false, false); }
+    }
+
+    interface Template6 {
+        int apply(int x);
+        static Template6 twice() { return x -> 2 * x; }
+        default Template6 andThen(Template6 next) { return x -> next.apply(apply(x)); }
+    }
+
+    static class Template7 {
+        static final int[] SQUARES = new int[64];
+        static {
+            for (int i = 0; i < SQUARES.length; i++) {
+                SQUARES[i] = i * i;
+            }
+        }
+        static Object box(long v) { return Long.valueOf(v); }
+        static double mix(double a, float b, short c) { return a * b + c; }
+    }
+}